@@ -0,0 +1,49 @@
+#include "benchmark_runner.hpp"
+#include "duckdb_benchmark_macro.hpp"
+
+#include <thread>
+
+using namespace duckdb;
+
+#define CONCURRENT_QUERY_COUNT 8
+
+// Runs queries with different priorities on concurrent connections, so that all threads of the scheduler dequeue
+// tasks while the producers are rebalanced
+#define CONCURRENT_QUERIES_BENCHMARK(PRIORITIES)                                                                       \
+	duckdb::vector<duckdb::unique_ptr<Connection>> connections;                                                        \
+	void Load(DuckDBBenchmarkState *state) override {                                                                  \
+		state->conn.Query("CREATE TABLE integers AS SELECT range AS i, range % 1000 AS j FROM range(10000000)");        \
+		for (idx_t i = 0; i < CONCURRENT_QUERY_COUNT; i++) {                                                           \
+			connections.push_back(make_uniq<Connection>(state->db));                                                   \
+			auto priority = PRIORITIES ? i % 4 + 1 : 1;                                                                \
+			connections.back()->Query("SET query_priority=" + to_string(priority));                                    \
+		}                                                                                                              \
+	}                                                                                                                  \
+	void RunBenchmark(DuckDBBenchmarkState *state) override {                                                          \
+		duckdb::vector<std::thread> threads;                                                                           \
+		for (auto &connection : connections) {                                                                         \
+			auto &con = *connection;                                                                                   \
+			threads.emplace_back([&con]() {                                                                            \
+				for (idx_t i = 0; i < 4; i++) {                                                                        \
+					con.Query("SELECT j, SUM(i) FROM integers GROUP BY j");                                            \
+				}                                                                                                      \
+			});                                                                                                        \
+		}                                                                                                              \
+		for (auto &thread : threads) {                                                                                 \
+			thread.join();                                                                                             \
+		}                                                                                                              \
+	}                                                                                                                  \
+	string VerifyResult(QueryResult *result) override {                                                                \
+		return string();                                                                                               \
+	}                                                                                                                  \
+	string BenchmarkInfo() override {                                                                                  \
+		return "Run aggregates concurrently on 8 connections";                                                         \
+	}
+
+DUCKDB_BENCHMARK(ConcurrentQueries, "[task_scheduler]")
+CONCURRENT_QUERIES_BENCHMARK(false);
+FINISH_BENCHMARK(ConcurrentQueries)
+
+DUCKDB_BENCHMARK(ConcurrentQueriesPriorities, "[task_scheduler]")
+CONCURRENT_QUERIES_BENCHMARK(true);
+FINISH_BENCHMARK(ConcurrentQueriesPriorities)
@@ -0,0 +1,268 @@
+# Generates files with small pages and a page index (ColumnIndex/OffsetIndex):
+# - page_index.parquet: two row groups of 10000 rows
+# - page_index_large.parquet: a single row group of 300000 rows, encoded compactly so it can be split over threads
+# Written without any dependencies, so the page layout is fully under control
+import struct
+
+DICT_VALUES = [b'apple', b'banana', b'cherry', b'date', b'elderberry']
+
+# thrift compact protocol
+T_BOOL_TRUE, T_BOOL_FALSE, T_I32, T_I64, T_BINARY, T_LIST, T_STRUCT = 1, 2, 5, 6, 8, 9, 12
+
+
+def varint(v):
+    out = bytearray()
+    while True:
+        if v < 0x80:
+            out.append(v)
+            return bytes(out)
+        out.append((v & 0x7F) | 0x80)
+        v >>= 7
+
+
+def zigzag(v):
+    return varint((v << 1) ^ (v >> 63))
+
+
+class Struct:
+    def __init__(self):
+        self.data = bytearray()
+        self.last = 0
+
+    def header(self, fid, ftype):
+        delta = fid - self.last
+        if 0 < delta <= 15:
+            self.data.append((delta << 4) | ftype)
+        else:
+            self.data.append(ftype)
+            self.data += zigzag(fid)
+        self.last = fid
+
+    def i32(self, fid, v):
+        self.header(fid, T_I32)
+        self.data += zigzag(v)
+        return self
+
+    def i64(self, fid, v):
+        self.header(fid, T_I64)
+        self.data += zigzag(v)
+        return self
+
+    def binary(self, fid, v):
+        self.header(fid, T_BINARY)
+        self.data += varint(len(v)) + v
+        return self
+
+    def struct(self, fid, s):
+        self.header(fid, T_STRUCT)
+        self.data += s.bytes()
+        return self
+
+    def list(self, fid, etype, values):
+        self.header(fid, T_LIST)
+        if len(values) < 15:
+            self.data.append((len(values) << 4) | etype)
+        else:
+            self.data.append(0xF0 | etype)
+            self.data += varint(len(values))
+        for v in values:
+            if etype in (T_I32, T_I64):
+                self.data += zigzag(v)
+            elif etype == T_BINARY:
+                self.data += varint(len(v)) + v
+            elif etype == T_STRUCT:
+                self.data += v.bytes()
+            elif etype == T_BOOL_TRUE:
+                self.data.append(T_BOOL_TRUE if v else T_BOOL_FALSE)
+        return self
+
+    def bytes(self):
+        return bytes(self.data) + b'\x00'
+
+
+def bitpacked(values, bit_width):
+    # RLE/bit-packing hybrid, using a single bit-packed run
+    groups = (len(values) + 7) // 8
+    values = values + [0] * (groups * 8 - len(values))
+    packed = 0
+    for i, v in enumerate(values):
+        packed |= v << (i * bit_width)
+    return varint((groups << 1) | 1) + packed.to_bytes(groups * bit_width, 'little')
+
+
+def rle(values, bit_width):
+    # RLE/bit-packing hybrid, using only RLE runs
+    out = b''
+    i = 0
+    while i < len(values):
+        run = 1
+        while i + run < len(values) and values[i + run] == values[i]:
+            run += 1
+        out += varint(run << 1) + values[i].to_bytes((bit_width + 7) // 8, 'little')
+        i += run
+    return out
+
+
+def delta_binary_packed(values):
+    # DELTA_BINARY_PACKED with blocks of 128 values in 4 miniblocks, only supports constant deltas
+    delta = values[1] - values[0] if len(values) > 1 else 0
+    assert all(values[i + 1] - values[i] == delta for i in range(len(values) - 1))
+    out = varint(128) + varint(4) + varint(len(values)) + zigzag(values[0])
+    for _ in range(0, len(values) - 1, 128):
+        # all deltas are equal to the minimum delta: every miniblock has a bit width of 0
+        out += zigzag(delta) + bytes(4)
+    return out
+
+
+def plain(physical, v):
+    if physical == 'INT64':
+        return struct.pack('<q', v)
+    if physical == 'INT32':
+        return struct.pack('<i', v)
+    return struct.pack('<I', len(v)) + v
+
+
+def stat(physical, v):
+    return v if physical == 'BYTE_ARRAY' else plain(physical, v)
+
+
+PHYSICAL_TYPES = {'INT32': 1, 'INT64': 2, 'BYTE_ARRAY': 6}
+
+# encodings of the values
+PLAIN, DICTIONARY, RLE_DICTIONARY, DELTA = 'plain', 'dictionary', 'rle_dictionary', 'delta'
+
+
+def write_file(path, row_group_size, row_group_count, columns):
+    out = bytearray(b'PAR1')
+    row_groups = []
+    for rg in range(row_group_count):
+        first_row = rg * row_group_size
+        chunks = []
+        for name, physical, optional, value_encoding, page_size, value_fun in columns:
+            dictionary = value_encoding in (DICTIONARY, RLE_DICTIONARY)
+            chunk_start = len(out)
+            dictionary_offset = None
+            if dictionary:
+                dictionary_offset = len(out)
+                data = b''.join(plain(physical, v) for v in DICT_VALUES)
+                header = Struct().i32(1, 2).i32(2, len(data)).i32(3, len(data))
+                header.struct(7, Struct().i32(1, len(DICT_VALUES)).i32(2, 0))
+                out += header.bytes() + data
+            locations = []
+            column_index = {'null_pages': [], 'min': [], 'max': [], 'null_counts': []}
+            data_page_offset = len(out)
+            null_count = 0
+            for page_start in range(0, row_group_size, page_size):
+                rows = [first_row + i for i in range(page_start, min(page_start + page_size, row_group_size))]
+                values = [value_fun(i) for i in rows]
+                valid = [v for v in values if v is not None]
+                data = b''
+                if optional:
+                    levels = bitpacked([0 if v is None else 1 for v in values], 1)
+                    data += struct.pack('<I', len(levels)) + levels
+                if value_encoding == DICTIONARY:
+                    data += bytes([3]) + bitpacked([DICT_VALUES.index(v) for v in valid], 3)
+                    encoding = 8
+                elif value_encoding == RLE_DICTIONARY:
+                    data += bytes([3]) + rle([DICT_VALUES.index(v) for v in valid], 3)
+                    encoding = 8
+                elif value_encoding == DELTA:
+                    data += delta_binary_packed(valid)
+                    encoding = 5
+                else:
+                    data += b''.join(plain(physical, v) for v in valid)
+                    encoding = 0
+                header = Struct().i32(1, 0).i32(2, len(data)).i32(3, len(data))
+                header.struct(5, Struct().i32(1, len(values)).i32(2, encoding).i32(3, 3).i32(4, 3))
+                page = header.bytes() + data
+                locations.append(Struct().i64(1, len(out)).i32(2, len(page)).i64(3, page_start))
+                out += page
+                column_index['null_pages'].append(len(valid) == 0)
+                column_index['min'].append(stat(physical, min(valid)) if valid else b'')
+                column_index['max'].append(stat(physical, max(valid)) if valid else b'')
+                column_index['null_counts'].append(len(values) - len(valid))
+                null_count += len(values) - len(valid)
+            chunk_size = len(out) - chunk_start
+            all_values = [v for v in (value_fun(first_row + i) for i in range(row_group_size)) if v is not None]
+            statistics = Struct().i64(3, null_count)
+            statistics.binary(5, stat(physical, max(all_values))).binary(6, stat(physical, min(all_values)))
+            meta_data = Struct().i32(1, PHYSICAL_TYPES[physical])
+            if dictionary:
+                encodings = [8, 0, 3]
+            elif value_encoding == DELTA:
+                encodings = [5, 3]
+            else:
+                encodings = [0, 3]
+            meta_data.list(2, T_I32, encodings)
+            meta_data.list(3, T_BINARY, [name.encode()]).i32(4, 0).i64(5, row_group_size)
+            meta_data.i64(6, chunk_size).i64(7, chunk_size).i64(9, data_page_offset)
+            if dictionary_offset is not None:
+                meta_data.i64(11, dictionary_offset)
+            meta_data.struct(12, statistics)
+            chunks.append((chunk_start, meta_data, locations, column_index, name))
+        row_groups.append((chunks, sum(len(c[1].bytes()) for c in chunks)))
+
+    # the page indexes are written after all row groups
+    column_chunks = []
+    for chunks, _ in row_groups:
+        rg_chunks = []
+        for chunk_start, meta_data, locations, column_index, name in chunks:
+            ci = Struct().list(1, T_BOOL_TRUE, column_index['null_pages'])
+            ci.list(2, T_BINARY, column_index['min']).list(3, T_BINARY, column_index['max'])
+            ci.i32(4, 1 if name in ('id', 'val') else 0).list(5, T_I64, column_index['null_counts'])
+            column_index_offset = len(out)
+            out += ci.bytes()
+            column_index_length = len(out) - column_index_offset
+            offset_index_offset = len(out)
+            out += Struct().list(1, T_STRUCT, locations).bytes()
+            offset_index_length = len(out) - offset_index_offset
+            chunk = Struct().i64(2, chunk_start).struct(3, meta_data)
+            chunk.i64(4, offset_index_offset).i32(5, offset_index_length)
+            chunk.i64(6, column_index_offset).i32(7, column_index_length)
+            rg_chunks.append(chunk)
+        column_chunks.append(rg_chunks)
+
+    schema = [Struct().binary(4, b'schema').i32(5, len(columns))]
+    for name, physical, optional, _, _, _ in columns:
+        element = Struct().i32(1, PHYSICAL_TYPES[physical]).i32(3, 1 if optional else 0).binary(4, name.encode())
+        if physical == 'BYTE_ARRAY':
+            element.i32(6, 0)
+        schema.append(element)
+
+    groups = []
+    for rg_chunks in column_chunks:
+        total_size = sum(len(c.bytes()) for c in rg_chunks)
+        groups.append(Struct().list(1, T_STRUCT, rg_chunks).i64(2, total_size).i64(3, row_group_size))
+
+    footer = Struct().i32(1, 1).list(2, T_STRUCT, schema).i64(3, row_group_size * row_group_count)
+    footer.list(4, T_STRUCT, groups).binary(6, b'page_index.py')
+    footer = footer.bytes()
+    out += footer + struct.pack('<I', len(footer)) + b'PAR1'
+
+    with open(path, 'wb') as f:
+        f.write(out)
+
+
+# name, physical type, optional, encoding, page size, value function
+write_file(
+    'page_index.parquet',
+    10000,
+    2,
+    [
+        ('id', 'INT64', False, PLAIN, 1000, lambda i: i),
+        ('val', 'BYTE_ARRAY', False, PLAIN, 1500, lambda i: b'value_%05d' % i),
+        ('opt', 'INT32', True, PLAIN, 2500, lambda i: None if i % 10 == 0 else i),
+        ('dict', 'BYTE_ARRAY', False, DICTIONARY, 2000, lambda i: DICT_VALUES[(i // 2000) % 5]),
+    ],
+)
+
+# the page sizes do not line up with each other or with the row ranges the row group is split in
+write_file(
+    'page_index_large.parquet',
+    300000,
+    1,
+    [
+        ('id', 'INT64', False, DELTA, 7000, lambda i: i),
+        ('dict', 'BYTE_ARRAY', False, RLE_DICTIONARY, 11000, lambda i: DICT_VALUES[(i // 1000) % 5]),
+    ],
+)
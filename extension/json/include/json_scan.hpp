@@ -133,6 +133,8 @@ public:
 	//! If a struct contains more fields than this threshold with at least 80% similar types,
 	//! we infer it as MAP type
 	idx_t map_inference_threshold = 25;
+	//! Whether the fields of records that are not projected are skipped by scanning, instead of being parsed
+	bool lazy_parsing = false;
 
 	//! All column names (in order)
 	vector<string> names;
@@ -180,6 +182,8 @@ public:
 	//! Column names that we're actually reading (after projection pushdown)
 	vector<string> names;
 	vector<column_t> column_indices;
+	//! Whether records are reduced to the projected fields before they are parsed
+	bool lazy_parsing = false;
 
 	//! Buffer manager allocator
 	Allocator &allocator;
@@ -246,6 +250,9 @@ private:
 	void ParseNextChunk(JSONScanGlobalState &gstate);
 
 	void ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining);
+	//! Reduces the record to the projected fields (in-place), skipping over the other fields without parsing them
+	//! Returns false (and leaves the record untouched) if the record is not a well-formed object
+	bool ProjectRecord(const vector<string> &names, char *const json_start, const idx_t json_size);
 	void ThrowObjectSizeError(const idx_t object_size);
 
 	//! Must hold the lock
@@ -279,6 +286,8 @@ private:
 
 	//! Buffer to reconstruct split values
 	AllocatedData reconstruct_buffer;
+	//! The (start, end) of the fields that are kept when projecting a record
+	vector<pair<const char *, const char *>> projected_fields;
 };
 
 struct JSONGlobalTableFunctionState : public GlobalTableFunctionState {
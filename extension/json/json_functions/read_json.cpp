@@ -253,6 +253,8 @@ unique_ptr<FunctionData> ReadJSONBind(ClientContext &context, TableFunctionBindI
 			}
 		} else if (loption == "convert_strings_to_integers") {
 			bind_data->convert_strings_to_integers = BooleanValue::Get(kv.second);
+		} else if (loption == "lazy_parsing") {
+			bind_data->lazy_parsing = BooleanValue::Get(kv.second);
 		}
 	}
 
@@ -376,6 +378,7 @@ TableFunction JSONFunctions::GetReadJSONTableFunction(shared_ptr<JSONScanInfo> f
 	table_function.named_parameters["timestamp_format"] = LogicalType::VARCHAR;
 	table_function.named_parameters["records"] = LogicalType::VARCHAR;
 	table_function.named_parameters["maximum_sample_files"] = LogicalType::BIGINT;
+	table_function.named_parameters["lazy_parsing"] = LogicalType::BOOLEAN;
 
 	// TODO: might be able to do filter pushdown/prune ?
 
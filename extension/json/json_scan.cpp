@@ -187,6 +187,11 @@ unique_ptr<GlobalTableFunctionState> JSONGlobalTableFunctionState::Init(ClientCo
 		gstate.names.push_back(bind_data.names[col_id]);
 	}
 
+	// If only some of the fields of the records are needed, we can skip over the others without parsing them
+	gstate.lazy_parsing = bind_data.lazy_parsing && bind_data.type == JSONScanType::READ_JSON &&
+	                      bind_data.options.record_type == JSONRecordType::RECORDS && !gstate.names.empty() &&
+	                      gstate.names.size() < bind_data.names.size();
+
 	if (gstate.names.size() < bind_data.names.size() || bind_data.options.file_options.union_by_name) {
 		// If we are auto-detecting, but don't need all columns present in the file,
 		// then we don't need to throw an error if we encounter an unseen column
@@ -367,6 +372,120 @@ static inline const char *NextJSON(const char *ptr, const idx_t size) {
 	return ptr == end ? nullptr : ptr;
 }
 
+static inline const char *SkipWhitespace(const char *ptr, const char *const end) {
+	while (ptr != end && StringUtil::CharacterIsSpace(*ptr)) {
+		ptr++;
+	}
+	return ptr;
+}
+
+//! Skips over a JSON value without parsing it, returns nullptr if the value does not end before "end"
+static inline const char *SkipJSONValue(const char *ptr, const char *const end) {
+	switch (*ptr) {
+	case '{':
+	case '[':
+	case '"':
+		ptr = NextJSONDefault(ptr, end);
+		break;
+	default:
+		// Numbers and literals end at the next structural character or whitespace
+		while (ptr != end && *ptr != ',' && *ptr != '}' && *ptr != ']' && !StringUtil::CharacterIsSpace(*ptr)) {
+			ptr++;
+		}
+	}
+	return ptr == end ? nullptr : ptr;
+}
+
+static inline bool IsProjectedKey(const vector<string> &names, const char *key, const idx_t key_size) {
+	for (const auto &name : names) {
+		if (name.size() == key_size && memcmp(name.c_str(), key, key_size) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool JSONScanLocalState::ProjectRecord(const vector<string> &names, char *const json_start, const idx_t json_size) {
+	const char *const end = json_start + json_size;
+	const char *ptr = json_start;
+	if (*ptr++ != '{') {
+		return false;
+	}
+
+	// Find the fields that we need to keep, bail out if the record is not a well-formed object
+	projected_fields.clear();
+	ptr = SkipWhitespace(ptr, end);
+	if (ptr != end && *ptr == '}') {
+		return false; // Empty object, nothing to skip
+	}
+	while (true) {
+		ptr = SkipWhitespace(ptr, end);
+		if (ptr == end || *ptr != '"') {
+			return false;
+		}
+		const auto field_start = ptr++;
+		const auto key_start = ptr;
+		bool key_escaped = false;
+		while (ptr != end && *ptr != '"') {
+			if (*ptr == '\\') {
+				key_escaped = true;
+				if (++ptr == end) {
+					return false;
+				}
+			}
+			ptr++;
+		}
+		if (ptr == end) {
+			return false;
+		}
+		const auto key_size = NumericCast<idx_t>(ptr - key_start);
+		ptr = SkipWhitespace(ptr + 1, end);
+		if (ptr == end || *ptr != ':') {
+			return false;
+		}
+		ptr = SkipWhitespace(ptr + 1, end);
+		if (ptr == end) {
+			return false;
+		}
+		const auto value_end = SkipJSONValue(ptr, end);
+		if (!value_end || value_end == ptr) {
+			return false;
+		}
+		// Keys with escapes are kept, so they are compared after being unescaped by the parser
+		if (key_escaped || IsProjectedKey(names, key_start, key_size)) {
+			projected_fields.emplace_back(field_start, value_end);
+		}
+		ptr = SkipWhitespace(value_end, end);
+		if (ptr == end) {
+			return false;
+		}
+		if (*ptr == ',') {
+			ptr++;
+			continue;
+		}
+		if (*ptr != '}') {
+			return false;
+		}
+		break;
+	}
+
+	// Rewrite the record in-place with only the projected fields, and pad the remainder with whitespace
+	const auto object_end = json_start + NumericCast<idx_t>(ptr - json_start) + 1;
+	auto write_ptr = json_start + 1;
+	for (idx_t field_idx = 0; field_idx < projected_fields.size(); field_idx++) {
+		if (field_idx != 0) {
+			*write_ptr++ = ',';
+		}
+		const auto &field = projected_fields[field_idx];
+		const auto field_size = NumericCast<idx_t>(field.second - field.first);
+		memmove(write_ptr, field.first, field_size);
+		write_ptr += field_size;
+	}
+	*write_ptr++ = '}';
+	memset(write_ptr, ' ', NumericCast<idx_t>(object_end - write_ptr));
+	return true;
+}
+
 static inline void TrimWhitespace(JSONString &line) {
 	while (line.size != 0 && StringUtil::CharacterIsSpace(line[0])) {
 		line.pointer++;
@@ -907,6 +1026,9 @@ void JSONScanLocalState::ParseNextChunk(JSONScanGlobalState &gstate) {
 		}
 
 		idx_t json_size = json_end - json_start;
+		if (gstate.lazy_parsing) {
+			ProjectRecord(gstate.names, json_start, json_size);
+		}
 		ParseJSON(json_start, json_size, remaining);
 		buffer_offset += json_size;
 
@@ -153,6 +153,84 @@ void ColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool allow_m
 	}
 }
 
+bool ColumnReader::CanSkipPages() {
+	if (!chunk || HasRepeats() || !chunk->__isset.offset_index_offset || reader.parquet_options.encryption_config) {
+		return false;
+	}
+	if (page_locations_loaded) {
+		return !page_locations.empty();
+	}
+	page_locations_loaded = true;
+
+	// page indexes are cached together with the file metadata
+	auto offset_index = reader.metadata->GetOffsetIndex(chunk->offset_index_offset);
+	if (!offset_index) {
+		auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+		auto location = trans.GetLocation();
+		trans.SetLocation(chunk->offset_index_offset);
+		auto read_index = make_shared_ptr<duckdb_parquet::format::OffsetIndex>();
+		reader.Read(*read_index, *protocol);
+		trans.SetLocation(location);
+		auto encoded_size = NumericCast<idx_t>(MaxValue<int32_t>(chunk->offset_index_length, 0));
+		reader.metadata->AddOffsetIndex(chunk->offset_index_offset, encoded_size, read_index);
+		offset_index = std::move(read_index);
+	}
+
+	// only use the page locations if they make sense: they must cover the whole chunk, in order
+	auto &locations = offset_index->page_locations;
+	if (locations.empty() || locations[0].first_row_index != 0) {
+		return false;
+	}
+	for (idx_t page_idx = 0; page_idx < locations.size(); page_idx++) {
+		auto &location = locations[page_idx];
+		if (location.offset < chunk->meta_data.data_page_offset || location.compressed_page_size <= 0) {
+			return false;
+		}
+		if (page_idx > 0 && (location.first_row_index <= locations[page_idx - 1].first_row_index ||
+		                     location.offset <= locations[page_idx - 1].offset)) {
+			return false;
+		}
+	}
+	if (NumericCast<idx_t>(locations.back().first_row_index) >= NumericCast<idx_t>(chunk->meta_data.num_values)) {
+		return false;
+	}
+	page_locations = locations;
+	return true;
+}
+
+const vector<PageLocation> &ColumnReader::GetPageLocations() const {
+	D_ASSERT(!page_locations.empty());
+	return page_locations;
+}
+
+void ColumnReader::RegisterPagePrefetch(ThriftFileTransport &transport, bool allow_merge,
+                                        const vector<ParquetRowRange> &skipped_rows) {
+	D_ASSERT(!page_locations.empty());
+	// the dictionary page (if any) is located before the first data page
+	auto file_offset = FileOffset();
+	auto first_page_offset = NumericCast<idx_t>(page_locations[0].offset);
+	if (file_offset < first_page_offset) {
+		transport.RegisterPrefetch(file_offset, first_page_offset - file_offset, allow_merge);
+	}
+	idx_t range_idx = 0;
+	for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+		auto &location = page_locations[page_idx];
+		auto page_start = NumericCast<idx_t>(location.first_row_index);
+		auto page_end = page_idx + 1 < page_locations.size()
+		                    ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+		                    : NumericCast<idx_t>(chunk->meta_data.num_values);
+		while (range_idx < skipped_rows.size() && skipped_rows[range_idx].end <= page_start) {
+			range_idx++;
+		}
+		if (range_idx < skipped_rows.size() && skipped_rows[range_idx].start <= page_start &&
+		    skipped_rows[range_idx].end >= page_end) {
+			continue; // all rows in this page are skipped
+		}
+		transport.RegisterPrefetch(NumericCast<idx_t>(location.offset),
+		                           NumericCast<idx_t>(location.compressed_page_size), allow_merge);
+	}
+}
+
 uint64_t ColumnReader::TotalCompressedSize() {
 	if (!chunk) {
 		return 0;
@@ -238,6 +316,13 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	// skips that were not applied yet (and the current page) belong to the previous column chunk
+	pending_skips = 0;
+	page_rows_available = 0;
+	page_locations_loaded = false;
+	page_locations.clear();
+	dictionary_size = 0;
+	dictionary_filter_evaluated = false;
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -257,10 +342,17 @@ void ColumnReader::PrepareRead(parquet_filter_t &filter) {
 		PreparePage(page_hdr);
 		PrepareDataPage(page_hdr);
 		break;
-	case PageType::DICTIONARY_PAGE:
+	case PageType::DICTIONARY_PAGE: {
 		PreparePage(page_hdr);
-		Dictionary(std::move(block), page_hdr.dictionary_page_header.num_values);
+		auto dictionary_entries = page_hdr.dictionary_page_header.num_values;
+		if (dictionary_entries < 0) {
+			throw std::runtime_error("Invalid dictionary page header (num_values < 0)");
+		}
+		Dictionary(std::move(block), NumericCast<idx_t>(dictionary_entries));
+		dictionary_size = NumericCast<idx_t>(dictionary_entries);
+		dictionary_filter_evaluated = false;
 		break;
+	}
 	default:
 		break; // ignore INDEX page type and any other custom extensions
 	}
@@ -530,9 +622,13 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 		if (dict_decoder) {
 			offset_buffer.resize(reader.allocator, sizeof(uint32_t) * (read_now - null_count));
 			dict_decoder->GetBatch<uint32_t>(offset_buffer.ptr, read_now - null_count);
+			auto offsets = reinterpret_cast<uint32_t *>(offset_buffer.ptr);
+			if (dictionary_filter && filter.any()) {
+				// only the rows whose dictionary entry passes the filter have to be materialized
+				ApplyDictionaryFilter(offsets, define_out, read_now, filter, result_offset);
+			}
 			DictReference(result);
-			Offsets(reinterpret_cast<uint32_t *>(offset_buffer.ptr), define_out, read_now, filter, result_offset,
-			        result);
+			Offsets(offsets, define_out, read_now, filter, result_offset, result);
 		} else if (dbp_decoder) {
 			// TODO keep this in the state
 			auto read_buf = make_shared_ptr<ResizeableBuffer>();
@@ -596,13 +692,100 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 	return num_values;
 }
 
+void ColumnReader::SetDictionaryFilter(optional_ptr<TableFilter> filter) {
+	dictionary_filter = filter;
+	dictionary_filter_evaluated = false;
+}
+
+void ColumnReader::EvaluateDictionaryFilter() {
+	D_ASSERT(dictionary_filter);
+	dictionary_filter_matches = make_unsafe_uniq_array<bool>(dictionary_size);
+	// materialize the dictionary one vector at a time and evaluate the filter on it
+	uint32_t offsets[STANDARD_VECTOR_SIZE];
+	uint8_t defines[STANDARD_VECTOR_SIZE];
+	memset(defines, NumericCast<uint8_t>(max_define), STANDARD_VECTOR_SIZE);
+	for (idx_t entry_idx = 0; entry_idx < dictionary_size; entry_idx += STANDARD_VECTOR_SIZE) {
+		auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, dictionary_size - entry_idx);
+		for (idx_t i = 0; i < count; i++) {
+			offsets[i] = NumericCast<uint32_t>(entry_idx + i);
+		}
+		parquet_filter_t entry_mask;
+		entry_mask.set();
+		Vector entries(type);
+		DictReference(entries);
+		Offsets(offsets, defines, count, entry_mask, 0, entries);
+		ParquetReader::ApplyFilter(entries, *dictionary_filter, entry_mask, count);
+		for (idx_t i = 0; i < count; i++) {
+			dictionary_filter_matches[entry_idx + i] = entry_mask.test(i);
+		}
+	}
+	dictionary_filter_evaluated = true;
+}
+
+void ColumnReader::ApplyDictionaryFilter(const uint32_t *offsets, const uint8_t *defines, idx_t num_values,
+                                         parquet_filter_t &filter, idx_t result_offset) {
+	if (!dictionary_filter_evaluated) {
+		EvaluateDictionaryFilter();
+	}
+	// NULL values have no dictionary offset, they are left for the regular filter evaluation
+	idx_t offset_idx = 0;
+	for (idx_t row_idx = result_offset; row_idx < result_offset + num_values; row_idx++) {
+		if (HasDefines() && defines[row_idx] != max_define) {
+			continue;
+		}
+		auto offset = offsets[offset_idx++];
+		if (offset < dictionary_size && !dictionary_filter_matches[offset]) {
+			filter.reset(row_idx);
+		}
+	}
+}
+
 void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	if (!CanSkipPages()) {
+		return 0;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	// the dictionary page has to be read before we jump over any data pages
+	auto first_page_offset = NumericCast<idx_t>(page_locations[0].offset);
+	while (page_rows_available == 0 && trans.GetLocation() < first_page_offset) {
+		PrepareRead(none_filter);
+		chunk_read_offset = trans.GetLocation();
+	}
+
+	// find the last page that starts at or before the row we want to skip to
+	auto current_row = NumericCast<idx_t>(chunk->meta_data.num_values) - group_rows_available;
+	auto target_row = current_row + num_values;
+	idx_t page_idx = page_locations.size() - 1;
+	while (page_idx > 0 && NumericCast<idx_t>(page_locations[page_idx].first_row_index) > target_row) {
+		page_idx--;
+	}
+	auto page_start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+	if (page_start <= current_row) {
+		return 0; // the target row is in the current page
+	}
+
+	// jump straight to the start of the page, without reading the pages in between
+	auto skipped = page_start - current_row;
+	page_rows_available = 0;
+	chunk_read_offset = NumericCast<idx_t>(page_locations[page_idx].offset);
+	trans.SetLocation(chunk_read_offset);
+	group_rows_available -= skipped;
+	return skipped;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
+	// skip over whole pages without reading them, if we know where they are
+	num_values -= SkipPages(num_values);
+	if (num_values == 0) {
+		return;
+	}
+
 	dummy_define.zero();
 	dummy_repeat.zero();
 
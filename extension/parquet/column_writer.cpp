@@ -495,6 +495,9 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	if (writer.WriteBloomFilter()) {
+		state.stats_state->bloom_filter_hashes = make_uniq<unsafe_vector<uint64_t>>();
+	}
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -728,6 +731,20 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	column_chunk.meta_data.total_compressed_size =
 	    UnsafeNumericCast<int64_t>(column_writer.GetTotalWritten() - start_offset);
 	column_chunk.meta_data.total_uncompressed_size = UnsafeNumericCast<int64_t>(total_uncompressed_size);
+
+	// build the Bloom filter (if any) from the distinct hashes of the values
+	auto &bloom_filter_hashes = state.stats_state->bloom_filter_hashes;
+	if (bloom_filter_hashes && !bloom_filter_hashes->empty()) {
+		std::sort(bloom_filter_hashes->begin(), bloom_filter_hashes->end());
+		auto end = std::unique(bloom_filter_hashes->begin(), bloom_filter_hashes->end());
+		auto distinct_count = NumericCast<idx_t>(end - bloom_filter_hashes->begin());
+		auto bloom_filter = make_uniq<ParquetBloomFilter>(distinct_count, writer.BloomFilterFalsePositiveRatio());
+		for (auto it = bloom_filter_hashes->begin(); it != end; it++) {
+			bloom_filter->Insert(*it);
+		}
+		bloom_filter_hashes.reset();
+		writer.BufferBloomFilter(state.col_idx, std::move(bloom_filter));
+	}
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -883,6 +900,7 @@ static void TemplatedWritePlain(Vector &col, ColumnWriterStatistics *stats, cons
 	static constexpr idx_t WRITE_COMBINER_CAPACITY = 8;
 	TGT write_combiner[WRITE_COMBINER_CAPACITY];
 	idx_t write_combiner_count = 0;
+	auto bloom_filter_hashes = stats ? stats->bloom_filter_hashes.get() : nullptr;
 
 	const auto *ptr = FlatVector::GetData<SRC>(col);
 	for (idx_t r = chunk_start; r < chunk_end; r++) {
@@ -891,6 +909,9 @@ static void TemplatedWritePlain(Vector &col, ColumnWriterStatistics *stats, cons
 		}
 		TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
 		OP::template HandleStats<SRC, TGT>(stats, ptr[r], target_value);
+		if (bloom_filter_hashes) {
+			bloom_filter_hashes->push_back(ParquetBloomFilter::Hash(target_value));
+		}
 		write_combiner[write_combiner_count++] = target_value;
 		if (write_combiner_count == WRITE_COMBINER_CAPACITY) {
 			ser.WriteData(const_data_ptr_cast(write_combiner), WRITE_COMBINER_CAPACITY * sizeof(TGT));
@@ -1463,11 +1484,16 @@ public:
 			}
 		} else {
 			// plain page
+			auto bloom_filter_hashes = stats.bloom_filter_hashes.get();
 			for (idx_t r = chunk_start; r < chunk_end; r++) {
 				if (!mask.RowIsValid(r)) {
 					continue;
 				}
 				stats.Update(ptr[r]);
+				if (bloom_filter_hashes) {
+					bloom_filter_hashes->push_back(
+					    ParquetBloomFilter::Hash(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize()));
+				}
 				temp_writer.Write<uint32_t>(ptr[r].GetSize());
 				temp_writer.WriteData(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize());
 			}
@@ -1527,6 +1553,10 @@ public:
 			auto &value = values[r];
 			// update the statistics
 			stats.Update(value);
+			if (stats.bloom_filter_hashes) {
+				stats.bloom_filter_hashes->push_back(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(value.GetData()), value.GetSize()));
+			}
 			// write this string value to the dictionary
 			temp_writer->Write<uint32_t>(value.GetSize());
 			temp_writer->WriteData(const_data_ptr_cast((value.GetData())), value.GetSize());
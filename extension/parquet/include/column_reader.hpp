@@ -26,6 +26,7 @@
 
 namespace duckdb {
 class ParquetReader;
+class TableFilter;
 
 using duckdb_apache::thrift::protocol::TProtocol;
 
@@ -33,11 +34,18 @@ using duckdb_parquet::format::ColumnChunk;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::PageHeader;
+using duckdb_parquet::format::PageLocation;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Type;
 
 typedef std::bitset<STANDARD_VECTOR_SIZE> parquet_filter_t;
 
+//! A range of rows [start, end) within a row group
+struct ParquetRowRange {
+	idx_t start;
+	idx_t end;
+};
+
 class ColumnReader {
 public:
 	ColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p, idx_t file_idx_p,
@@ -68,8 +76,21 @@ public:
 	// register the range this reader will touch for prefetching
 	virtual void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge);
 
+	//! Whether this reader can skip whole pages of the current column chunk, i.e., whether the chunk has an OffsetIndex
+	//! This reads the OffsetIndex if it was not read yet
+	bool CanSkipPages();
+	//! The locations of the pages in the current column chunk, only available if CanSkipPages() returns true
+	const vector<PageLocation> &GetPageLocations() const;
+	//! Register the pages that contain rows outside of the (sorted) skipped row ranges for prefetching
+	void RegisterPagePrefetch(ThriftFileTransport &transport, bool allow_merge,
+	                          const vector<ParquetRowRange> &skipped_rows);
+
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
 
+	//! Sets the filter of this column, which is evaluated once per dictionary entry for dictionary-encoded pages
+	//! Rows whose dictionary entry does not pass the filter are removed from the filter mask passed to Read()
+	void SetDictionaryFilter(optional_ptr<TableFilter> filter);
+
 	template <class VALUE_TYPE, class CONVERSION>
 	void PlainTemplated(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, uint64_t num_values,
 	                    parquet_filter_t &filter, idx_t result_offset, Vector &result) {
@@ -163,11 +184,18 @@ private:
 	void AllocateBlock(idx_t size);
 	void AllocateCompressed(idx_t size);
 	void PrepareRead(parquet_filter_t &filter);
+	//! Skips the whole pages that are covered by skipping "num_values" values, returns the number of values skipped
+	idx_t SkipPages(idx_t num_values);
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
 	void DecompressInternal(CompressionCodec::type codec, const_data_ptr_t src, idx_t src_size, data_ptr_t dst,
 	                        idx_t dst_size);
+	//! Evaluates the dictionary filter on all entries of the current dictionary
+	void EvaluateDictionaryFilter();
+	//! Removes the rows whose dictionary entry does not pass the dictionary filter from the filter mask
+	void ApplyDictionaryFilter(const uint32_t *offsets, const uint8_t *defines, idx_t num_values,
+	                           parquet_filter_t &filter, idx_t result_offset);
 
 	const duckdb_parquet::format::ColumnChunk *chunk = nullptr;
 
@@ -188,6 +216,20 @@ private:
 	unique_ptr<RleBpDecoder> rle_decoder;
 	unique_ptr<BssDecoder> bss_decoder;
 
+	//! Whether we tried to read the OffsetIndex of the current column chunk
+	bool page_locations_loaded = false;
+	//! The locations of the pages in the current column chunk (from the OffsetIndex)
+	vector<PageLocation> page_locations;
+
+	//! The filter on this column that is evaluated on the dictionary (if any)
+	optional_ptr<TableFilter> dictionary_filter;
+	//! The number of entries in the dictionary of the current column chunk
+	idx_t dictionary_size = 0;
+	//! Whether dictionary_filter_matches has been computed for the current dictionary
+	bool dictionary_filter_evaluated = false;
+	//! For every entry of the current dictionary, whether it passes the dictionary filter
+	unsafe_unique_array<bool> dictionary_filter_matches;
+
 	// dummies for Skip()
 	parquet_filter_t none_filter;
 	ResizeableBuffer dummy_define;
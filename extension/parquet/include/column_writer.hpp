@@ -50,6 +50,9 @@ public:
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
 
+	//! The hashes of the (plain encoded) values of the column chunk, only gathered when writing Bloom filters
+	unique_ptr<unsafe_vector<uint64_t>> bloom_filter_hashes;
+
 public:
 	template <class TARGET>
 	TARGET &Cast() {
@@ -27,6 +27,8 @@ public:
 	void ApplyPendingSkips(idx_t num_values) override;
 
 	void InitializeRead(idx_t row_group_idx_p, const vector<ColumnChunk> &columns, TProtocol &protocol_p) override {
+		pending_skips = 0;
+		overflow_child_count = 0;
 		child_column_reader->InitializeRead(row_group_idx_p, columns, protocol_p);
 	}
 
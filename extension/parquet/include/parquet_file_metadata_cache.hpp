@@ -9,6 +9,10 @@
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/function/table_function.hpp"
 #include "duckdb/storage/object_cache.hpp"
 #include "geo_parquet.hpp"
 #endif
@@ -36,6 +40,14 @@ public:
 	//! GeoParquet metadata
 	unique_ptr<GeoParquetFileMetadata> geo_metadata;
 
+	//! The last modification time and the size of the file when the metadata was read
+	time_t last_modified = 0;
+	idx_t file_size = 0;
+	//! The size of the (encoded) footer
+	idx_t footer_size = 0;
+	//! Whether the footer was encrypted
+	bool footer_encrypted = false;
+
 public:
 	static string ObjectType() {
 		return "parquet_metadata";
@@ -44,5 +56,95 @@ public:
 	string GetObjectType() override {
 		return ObjectType();
 	}
+
+	//! Whether the metadata still describes the file with the given modification time and size
+	bool IsValid(time_t last_modified_p, idx_t file_size_p) const;
+	//! The (approximate) amount of memory used by the metadata, based on the encoded size of the footer and indexes
+	idx_t EstimatedSize();
+
+	//! Get the cached OffsetIndex / ColumnIndex located at an offset in the file, or nullptr if it was not read yet
+	shared_ptr<const duckdb_parquet::format::OffsetIndex> GetOffsetIndex(int64_t offset);
+	shared_ptr<const duckdb_parquet::format::ColumnIndex> GetColumnIndex(int64_t offset);
+	//! Cache an OffsetIndex / ColumnIndex that was read from the file
+	void AddOffsetIndex(int64_t offset, idx_t encoded_size,
+	                    shared_ptr<const duckdb_parquet::format::OffsetIndex> index);
+	void AddColumnIndex(int64_t offset, idx_t encoded_size,
+	                    shared_ptr<const duckdb_parquet::format::ColumnIndex> index);
+
+private:
+	mutex page_index_lock;
+	//! The page indexes that were read for the column chunks of this file, by their offset in the file
+	unordered_map<int64_t, shared_ptr<const duckdb_parquet::format::OffsetIndex>> offset_indexes;
+	unordered_map<int64_t, shared_ptr<const duckdb_parquet::format::ColumnIndex>> column_indexes;
+	//! The encoded size of the cached page indexes
+	idx_t page_index_size = 0;
+};
+
+struct ParquetMetadataCacheEntry {
+	shared_ptr<ParquetFileMetadataCache> metadata;
+	//! Position of the entry in the LRU list
+	list<string>::iterator lru_position;
+};
+
+//! ParquetMetadataCache caches the metadata of Parquet files across queries
+//! The cache is bounded by a memory budget, the least recently used files are evicted first
+class ParquetMetadataCache : public ObjectCacheEntry {
+public:
+	ParquetMetadataCache();
+	~ParquetMetadataCache() override;
+
+public:
+	//! Get the metadata cache of the database, returns nullptr if metadata caching is disabled
+	static shared_ptr<ParquetMetadataCache> Get(ClientContext &context);
+
+	//! Look up the metadata of a file, returns nullptr if the file is not cached or if it changed since it was cached
+	shared_ptr<ParquetFileMetadataCache> Lookup(const string &path, time_t last_modified, idx_t file_size);
+	//! Look up the metadata of a file without validating it against the file
+	shared_ptr<ParquetFileMetadataCache> LookupUnchecked(const string &path);
+	//! Add (or replace) the metadata of a file
+	void Insert(const string &path, shared_ptr<ParquetFileMetadataCache> metadata);
+
+	idx_t EntryCount();
+	idx_t EstimatedSize();
+	idx_t SizeLimit();
+	idx_t Hits();
+	idx_t Misses();
+	idx_t Evictions();
+
+	static string ObjectType() {
+		return "parquet_metadata_cache";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	//! Update the memory budget and the file the cache is persisted in
+	void Configure(ClientContext &context, idx_t size_limit, const string &path);
+	//! Evict the least recently used entries until the cache fits in its memory budget
+	void EvictInternal();
+	void LoadInternal(ClientContext &context);
+	void Save();
+
+private:
+	mutex lock;
+	unordered_map<string, ParquetMetadataCacheEntry> entries;
+	//! The cached files, from most to least recently used
+	list<string> lru;
+	idx_t size_limit;
+	//! The local file the cache is loaded from and saved to (if any)
+	string persist_path;
+	//! Whether entries were added since the cache was loaded
+	bool modified = false;
+	idx_t hits = 0;
+	idx_t misses = 0;
+	idx_t evictions = 0;
+};
+
+class ParquetMetadataCacheFunction : public TableFunction {
+public:
+	ParquetMetadataCacheFunction();
 };
+
 } // namespace duckdb
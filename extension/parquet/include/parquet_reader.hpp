@@ -64,6 +64,18 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! Sorted ranges of rows in the current row group that are skipped, because the page index rules them out
+	vector<ParquetRowRange> skipped_rows;
+	//! The next range in skipped_rows
+	idx_t skipped_rows_idx = 0;
+	//! The columns of the current row group with a filter that the row group statistics could not decide - only
+	//! for these columns the page index can skip more rows
+	vector<idx_t> page_filter_columns;
+	//! The range of rows [group_row_start, group_row_end) of the row group that is scanned
+	//! This is only used when a single row group is split over multiple scans
+	idx_t group_row_start = 0;
+	idx_t group_row_end = NumericLimits<idx_t>::Maximum();
 };
 
 struct ParquetColumnDefinition {
@@ -117,6 +129,8 @@ struct ParquetUnionData {
 class ParquetReader {
 public:
 	using UNION_READER_DATA = unique_ptr<ParquetUnionData>;
+	//! The number of rows read by every scan of a row group that is split over multiple scans
+	static constexpr idx_t ROW_GROUP_SPLIT_SIZE = 122880;
 
 public:
 	ParquetReader(ClientContext &context, string file_name, ParquetOptions parquet_options,
@@ -165,6 +179,9 @@ public:
 
 	idx_t NumRows();
 	idx_t NumRowGroups();
+	//! The number of scans a row group is split into, so that large row groups can be read by multiple threads
+	//! A row group is only split if all of its columns have a page index, every scan reads ROW_GROUP_SPLIT_SIZE rows
+	idx_t RowGroupSplitCount(idx_t group_idx);
 
 	const duckdb_parquet::format::FileMetaData *GetFileMetadata();
 
@@ -191,6 +208,8 @@ public:
 
 	static unique_ptr<BaseStatistics> ReadStatistics(ClientContext &context, ParquetOptions parquet_options,
 	                                                 shared_ptr<ParquetFileMetadataCache> metadata, const string &name);
+	//! Evaluates a table filter on the first "count" rows of a vector, clearing the rows that do not pass in the mask
+	static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count);
 
 private:
 	//! Construct a parquet reader but **do not** open a file, used in ReadStatistics only
@@ -209,6 +228,14 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Reads the Bloom filter of the column chunk (if any) and checks whether it excludes all rows of the chunk
+	bool BloomFilterExcludes(ParquetReaderScanState &state, const ColumnReader &column_reader,
+	                         const TableFilter &filter);
+	//! Uses the page index (ColumnIndex) of the filtered columns to find the rows of the group that can be skipped
+	void PrunePages(ParquetReaderScanState &state);
+	//! Fetches the page indexes of the given columns that are not cached yet with a single read (in prefetch mode)
+	void PrefetchPageIndexes(ParquetReaderScanState &state, const vector<idx_t> &column_indexes,
+	                         bool read_column_index);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
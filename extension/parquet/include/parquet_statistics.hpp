@@ -10,14 +10,60 @@ namespace duckdb {
 
 using duckdb_parquet::format::ColumnChunk;
 using duckdb_parquet::format::SchemaElement;
+using duckdb_parquet::format::Statistics;
 
 struct LogicalType;
 class ColumnReader;
+class TableFilter;
+
+//! A split block Bloom filter, as specified by the Parquet format. The filter consists of blocks of 256 bits, each
+//! value sets (and checks) eight bits in a single block.
+class ParquetBloomFilter {
+public:
+	static constexpr const idx_t BYTES_PER_BLOCK = 32;
+	//! The maximum size of a Bloom filter (as recommended by the Parquet format)
+	static constexpr const idx_t MAX_BYTES = 128 * 1024 * 1024;
+
+public:
+	//! Creates an empty filter that holds "distinct_count" values at (approximately) the given false positive ratio
+	ParquetBloomFilter(idx_t distinct_count, double false_positive_ratio);
+	//! Creates an empty filter of "num_bytes" bytes, e.g. to read a filter into
+	explicit ParquetBloomFilter(idx_t num_bytes);
+
+	//! Hashes the (plain encoded) value, as used by Parquet Bloom filters
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+	template <class T>
+	static uint64_t Hash(const T &value) {
+		return Hash(const_data_ptr_cast(&value), sizeof(T));
+	}
+
+	void Insert(uint64_t hash);
+	bool Contains(uint64_t hash) const;
+
+	data_ptr_t Data() {
+		return data_ptr_cast(bitset.data());
+	}
+	idx_t SizeInBytes() const {
+		return bitset.size() * sizeof(uint32_t);
+	}
+
+private:
+	vector<uint32_t> bitset;
+};
 
 struct ParquetStatisticsUtils {
 
 	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ColumnReader &reader,
 	                                                            const vector<ColumnChunk> &columns);
+	//! Transforms the statistics of a (flat) column chunk or page
+	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ColumnReader &reader,
+	                                                            const Statistics &parquet_stats);
+
+	//! Whether or not the filter contains (in)equality checks that can be answered using a Bloom filter
+	static bool BloomFilterSupported(const ColumnReader &reader, const TableFilter &filter);
+	//! Whether or not the Bloom filter of a column chunk proves that no row in the chunk passes the filter
+	static bool BloomFilterExcludes(const ColumnReader &reader, const TableFilter &filter,
+	                                const ParquetBloomFilter &bloom_filter);
 
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
@@ -20,6 +20,7 @@
 #endif
 
 #include "column_writer.hpp"
+#include "parquet_statistics.hpp"
 #include "parquet_types.h"
 #include "geo_parquet.hpp"
 #include "thrift/protocol/TCompactProtocol.h"
@@ -38,6 +39,13 @@ struct PreparedRowGroup {
 	vector<shared_ptr<StringHeap>> heaps;
 };
 
+//! A Bloom filter of a column chunk, which is written to the file when the file is finalized
+struct ParquetBloomFilterEntry {
+	idx_t row_group_idx;
+	idx_t column_idx;
+	unique_ptr<ParquetBloomFilter> bloom_filter;
+};
+
 struct FieldID;
 struct ChildFieldIDs {
 	ChildFieldIDs();
@@ -67,7 +75,8 @@ public:
 	              vector<string> names, duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
-	              optional_idx compression_level, bool debug_use_openssl);
+	              optional_idx compression_level, bool debug_use_openssl, bool write_bloom_filter,
+	              double bloom_filter_false_positive_ratio);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -103,6 +112,12 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	bool WriteBloomFilter() const {
+		return write_bloom_filter;
+	}
+	double BloomFilterFalsePositiveRatio() const {
+		return bloom_filter_false_positive_ratio;
+	}
 	idx_t NumberOfRowGroups() {
 		lock_guard<mutex> glock(lock);
 		return file_meta_data.row_groups.size();
@@ -110,6 +125,8 @@ public:
 
 	uint32_t Write(const duckdb_apache::thrift::TBase &object);
 	uint32_t WriteData(const const_data_ptr_t buffer, const uint32_t buffer_size);
+	//! Buffers the Bloom filter of a column chunk of the row group that is currently being flushed
+	void BufferBloomFilter(idx_t column_idx, unique_ptr<ParquetBloomFilter> bloom_filter);
 
 	GeoParquetFileMetadata &GetGeoParquetData();
 
@@ -126,6 +143,8 @@ private:
 	double dictionary_compression_ratio_threshold;
 	optional_idx compression_level;
 	bool debug_use_openssl;
+	bool write_bloom_filter;
+	double bloom_filter_false_positive_ratio;
 	shared_ptr<EncryptionUtil> encryption_util;
 
 	unique_ptr<BufferedFileWriter> writer;
@@ -134,6 +153,8 @@ private:
 	std::mutex lock;
 
 	vector<unique_ptr<ColumnWriter>> column_writers;
+	//! The Bloom filters are written together, after all row groups
+	vector<ParquetBloomFilterEntry> bloom_filters;
 
 	unique_ptr<GeoParquetFileMetadata> geoparquet_data;
 };
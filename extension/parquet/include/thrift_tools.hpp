@@ -103,9 +103,12 @@ struct ReadAheadBuffer {
 		return nullptr;
 	}
 
-	// Prefetch all read heads
+	// Prefetch all read heads that have not been fetched yet
 	void Prefetch() {
 		for (auto &read_head : read_heads) {
+			if (read_head.data_isset) {
+				continue;
+			}
 			read_head.Allocate(allocator);
 
 			if (read_head.GetEnd() > handle.GetFileSize()) {
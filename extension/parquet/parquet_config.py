@@ -26,6 +26,7 @@ source_files = [
         'extension/parquet/column_writer.cpp',
         'extension/parquet/parquet_crypto.cpp',
         'extension/parquet/parquet_extension.cpp',
+        'extension/parquet/parquet_file_metadata_cache.cpp',
         'extension/parquet/parquet_metadata.cpp',
         'extension/parquet/parquet_reader.cpp',
         'extension/parquet/parquet_statistics.cpp',
@@ -76,9 +77,6 @@ source_files += [
         'third_party/zstd/compress/zstd_opt.cpp',
     ]
 ]
-# lz4
-source_files += [os.path.sep.join(x.split('/')) for x in ['third_party/lz4/lz4.cpp']]
-
 # brotli
 source_files += [
     os.path.sep.join(x.split('/'))
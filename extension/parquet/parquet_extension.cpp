@@ -11,6 +11,7 @@
 #include "duckdb/planner/query_node/bound_select_node.hpp"
 #include "geo_parquet.hpp"
 #include "parquet_crypto.hpp"
+#include "parquet_file_metadata_cache.hpp"
 #include "parquet_metadata.hpp"
 #include "parquet_reader.hpp"
 #include "parquet_writer.hpp"
@@ -77,7 +78,10 @@ struct ParquetReadBindData : public TableFunctionData {
 	void Initialize(shared_ptr<ParquetReader> reader) {
 		initial_reader = std::move(reader);
 		initial_file_cardinality = initial_reader->NumRows();
-		initial_file_row_groups = initial_reader->NumRowGroups();
+		initial_file_row_groups = 0;
+		for (idx_t group_idx = 0; group_idx < initial_reader->NumRowGroups(); group_idx++) {
+			initial_file_row_groups += initial_reader->RowGroupSplitCount(group_idx);
+		}
 		parquet_options = initial_reader->parquet_options;
 	}
 	void Initialize(ClientContext &, unique_ptr<ParquetUnionData> &union_data) {
@@ -159,6 +163,8 @@ struct ParquetReadGlobalState : public GlobalTableFunctionState {
 	atomic<idx_t> file_index;
 	//! Index of row group within file currently up for scanning
 	idx_t row_group_index;
+	//! Index of the range of rows within the row group up for scanning (if the row group is split)
+	idx_t row_group_split_index = 0;
 	//! Batch index of the next row group to be scanned
 	idx_t batch_index;
 
@@ -201,6 +207,11 @@ struct ParquetWriteBindData : public TableFunctionData {
 	ChildFieldIDs field_ids;
 	//! The compression level, higher value is more
 	optional_idx compression_level;
+
+	//! Whether or not to write a Bloom filter for every column chunk
+	bool write_bloom_filter = false;
+	//! The false positive ratio the Bloom filters are sized for
+	double bloom_filter_false_positive_ratio = 0.01;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -407,6 +418,8 @@ public:
 		table_function.projection_pushdown = true;
 		table_function.filter_pushdown = true;
 		table_function.filter_prune = true;
+		table_function.in_filter_pushdown = true;
+		table_function.dynamic_filter_pushdown = true;
 		table_function.pushdown_complex_filter = ParquetComplexFilterPushdown;
 
 		MultiFileReader::AddParameters(table_function);
@@ -461,27 +474,26 @@ public:
 
 		// NOTE: we do not want to parse the Parquet metadata for the sole purpose of getting column statistics
 
-		auto &config = DBConfig::GetConfig(context);
+		auto metadata_cache = ParquetMetadataCache::Get(context);
 
 		if (bind_data.file_list->GetExpandResult() != FileExpandResult::MULTIPLE_FILES) {
 			if (bind_data.initial_reader) {
 				// most common path, scanning single parquet file
 				return bind_data.initial_reader->ReadStatistics(bind_data.names[column_index]);
-			} else if (!config.options.object_cache_enable) {
+			} else if (!metadata_cache) {
 				// our initial reader was reset
 				return nullptr;
 			}
-		} else if (config.options.object_cache_enable) {
-			// multiple files, object cache enabled: merge statistics
+		} else if (metadata_cache) {
+			// multiple files, metadata cache enabled: merge statistics
 			unique_ptr<BaseStatistics> overall_stats;
 
-			auto &cache = ObjectCache::GetObjectCache(context);
-			// for more than one file, we could be lucky and metadata for *every* file is in the object cache (if
+			// for more than one file, we could be lucky and metadata for *every* file is in the metadata cache (if
 			// enabled at all)
 			FileSystem &fs = FileSystem::GetFileSystem(context);
 
 			for (const auto &file_name : bind_data.file_list->Files()) {
-				auto metadata = cache.Get<ParquetFileMetadataCache>(file_name);
+				auto metadata = metadata_cache->LookupUnchecked(file_name);
 				if (!metadata) {
 					// missing metadata entry in cache, no usable stats
 					return nullptr;
@@ -489,7 +501,8 @@ public:
 				if (!fs.IsRemoteFile(file_name)) {
 					auto handle = fs.OpenFile(file_name, FileFlags::FILE_FLAGS_READ);
 					// we need to check if the metadata cache entries are current
-					if (fs.GetLastModifiedTime(*handle) >= metadata->read_time) {
+					auto file_size = NumericCast<idx_t>(handle->GetFileSize());
+					if (!metadata->IsValid(fs.GetLastModifiedTime(*handle), file_size)) {
 						// missing or invalid metadata entry in cache, no usable stats overall
 						return nullptr;
 					}
@@ -513,7 +526,7 @@ public:
 			return overall_stats;
 		}
 
-		// multiple files and no object cache, no luck!
+		// multiple files and no metadata cache, no luck!
 		return nullptr;
 	}
 
@@ -901,7 +914,20 @@ public:
 					scan_data.reader->InitializeScan(context, scan_data.scan_state, group_indexes);
 					scan_data.batch_index = parallel_state.batch_index++;
 					scan_data.file_index = parallel_state.file_index;
-					parallel_state.row_group_index++;
+
+					// large row groups are split into ranges of rows that are scanned by different threads
+					auto split_count = scan_data.reader->RowGroupSplitCount(parallel_state.row_group_index);
+					if (split_count > 1) {
+						auto split_start = parallel_state.row_group_split_index * ParquetReader::ROW_GROUP_SPLIT_SIZE;
+						scan_data.scan_state.group_row_start = split_start;
+						scan_data.scan_state.group_row_end = split_start + ParquetReader::ROW_GROUP_SPLIT_SIZE;
+						parallel_state.row_group_split_index++;
+					}
+					if (parallel_state.row_group_split_index == 0 ||
+					    parallel_state.row_group_split_index >= split_count) {
+						parallel_state.row_group_index++;
+						parallel_state.row_group_split_index = 0;
+					}
 					return true;
 				} else {
 					// Close current file
@@ -911,6 +937,7 @@ public:
 					// Set state to the next file
 					parallel_state.file_index++;
 					parallel_state.row_group_index = 0;
+					parallel_state.row_group_split_index = 0;
 
 					continue;
 				}
@@ -1273,10 +1300,21 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			}
 		} else if (loption == "compression_level") {
 			bind_data->compression_level = option.second[0].GetValue<uint64_t>();
+		} else if (loption == "write_bloom_filter") {
+			bind_data->write_bloom_filter = BooleanValue::Get(option.second[0].DefaultCastAs(LogicalType::BOOLEAN));
+		} else if (loption == "bloom_filter_false_positive_ratio") {
+			auto val = option.second[0].GetValue<double>();
+			if (val <= 0 || val >= 1) {
+				throw BinderException("bloom_filter_false_positive_ratio must be greater than 0 and smaller than 1");
+			}
+			bind_data->bloom_filter_false_positive_ratio = val;
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
 	}
+	if (bind_data->write_bloom_filter && bind_data->encryption_config) {
+		throw BinderException("WRITE_BLOOM_FILTER is not supported for encrypted Parquet files");
+	}
 	if (row_group_size_bytes_set) {
 		if (DBConfig::GetConfig(context).options.preserve_insertion_order) {
 			throw BinderException("ROW_GROUP_SIZE_BYTES does not work while preserving insertion order. Use \"SET "
@@ -1302,7 +1340,8 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	    make_uniq<ParquetWriter>(context, fs, file_path, parquet_bind.sql_types, parquet_bind.column_names,
 	                             parquet_bind.codec, parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata,
 	                             parquet_bind.encryption_config, parquet_bind.dictionary_compression_ratio_threshold,
-	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl);
+	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl,
+	                             parquet_bind.write_bloom_filter, parquet_bind.bloom_filter_false_positive_ratio);
 	return std::move(global_state);
 }
 
@@ -1426,6 +1465,9 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WritePropertyWithDefault<optional_idx>(109, "compression_level", bind_data.compression_level);
 	serializer.WriteProperty(110, "row_groups_per_file", bind_data.row_groups_per_file);
 	serializer.WriteProperty(111, "debug_use_openssl", bind_data.debug_use_openssl);
+	serializer.WritePropertyWithDefault<bool>(112, "write_bloom_filter", bind_data.write_bloom_filter, false);
+	serializer.WritePropertyWithDefault<double>(113, "bloom_filter_false_positive_ratio",
+	                                            bind_data.bloom_filter_false_positive_ratio, 0.01);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1445,6 +1487,9 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	data->row_groups_per_file =
 	    deserializer.ReadPropertyWithExplicitDefault<optional_idx>(110, "row_groups_per_file", optional_idx::Invalid());
 	data->debug_use_openssl = deserializer.ReadPropertyWithExplicitDefault<bool>(111, "debug_use_openssl", true);
+	data->write_bloom_filter = deserializer.ReadPropertyWithExplicitDefault<bool>(112, "write_bloom_filter", false);
+	data->bloom_filter_false_positive_ratio =
+	    deserializer.ReadPropertyWithExplicitDefault<double>(113, "bloom_filter_false_positive_ratio", 0.01);
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
@@ -1619,6 +1664,11 @@ static vector<unique_ptr<Expression>> ParquetWriteSelect(CopyToSelectInput &inpu
 	return {};
 }
 
+static void SetParquetMetadataCacheSize(ClientContext &context, SetScope scope, Value &parameter) {
+	// verify that the memory budget can be parsed
+	DBConfig::ParseMemoryLimit(parameter.ToString());
+}
+
 void ParquetExtension::Load(DuckDB &db) {
 	auto &db_instance = *db.instance;
 	auto &fs = db.GetFileSystem();
@@ -1646,6 +1696,10 @@ void ParquetExtension::Load(DuckDB &db) {
 	ParquetFileMetadataFunction file_meta_fun;
 	ExtensionUtil::RegisterFunction(db_instance, MultiFileReader::CreateFunctionSet(file_meta_fun));
 
+	// parquet_metadata_cache
+	ParquetMetadataCacheFunction metadata_cache_fun;
+	ExtensionUtil::RegisterFunction(db_instance, metadata_cache_fun);
+
 	CopyFunction function("parquet");
 	function.copy_to_select = ParquetWriteSelect;
 	function.copy_to_bind = ParquetWriteBind;
@@ -1677,6 +1731,15 @@ void ParquetExtension::Load(DuckDB &db) {
 	config.replacement_scans.emplace_back(ParquetScanReplacement);
 	config.AddExtensionOption("binary_as_string", "In Parquet files, interpret binary data as a string.",
 	                          LogicalType::BOOLEAN);
+	config.AddExtensionOption("enable_parquet_metadata_cache",
+	                          "Cache the metadata of Parquet files across queries",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("parquet_metadata_cache_size",
+	                          "The maximum amount of memory used by the Parquet metadata cache (e.g. 1GB)",
+	                          LogicalType::VARCHAR, Value("256MB"), SetParquetMetadataCacheSize);
+	config.AddExtensionOption("parquet_metadata_cache_path",
+	                          "A local file the Parquet metadata cache is loaded from, and saved to on shutdown",
+	                          LogicalType::VARCHAR, Value(""));
 }
 
 std::string ParquetExtension::Name() {
@@ -0,0 +1,389 @@
+#include "parquet_file_metadata_cache.hpp"
+
+#include "thrift_tools.hpp"
+
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/main/config.hpp"
+#endif
+
+namespace duckdb {
+
+using duckdb_apache::thrift::protocol::TCompactProtocolT;
+using duckdb_apache::thrift::transport::TMemoryBuffer;
+
+//===--------------------------------------------------------------------===//
+// ParquetFileMetadataCache
+//===--------------------------------------------------------------------===//
+bool ParquetFileMetadataCache::IsValid(time_t last_modified_p, idx_t file_size_p) const {
+	if (last_modified != last_modified_p || file_size != file_size_p) {
+		return false;
+	}
+	// the modification time only has a resolution of seconds: files that were modified (shortly) before the metadata
+	// was read could have been modified again afterwards without changing the modification time
+	return last_modified_p + 10 < read_time;
+}
+
+idx_t ParquetFileMetadataCache::EstimatedSize() {
+	lock_guard<mutex> guard(page_index_lock);
+	return footer_size + page_index_size;
+}
+
+shared_ptr<const duckdb_parquet::format::OffsetIndex> ParquetFileMetadataCache::GetOffsetIndex(int64_t offset) {
+	lock_guard<mutex> guard(page_index_lock);
+	auto entry = offset_indexes.find(offset);
+	if (entry == offset_indexes.end()) {
+		return nullptr;
+	}
+	return entry->second;
+}
+
+shared_ptr<const duckdb_parquet::format::ColumnIndex> ParquetFileMetadataCache::GetColumnIndex(int64_t offset) {
+	lock_guard<mutex> guard(page_index_lock);
+	auto entry = column_indexes.find(offset);
+	if (entry == column_indexes.end()) {
+		return nullptr;
+	}
+	return entry->second;
+}
+
+void ParquetFileMetadataCache::AddOffsetIndex(int64_t offset, idx_t encoded_size,
+                                              shared_ptr<const duckdb_parquet::format::OffsetIndex> index) {
+	lock_guard<mutex> guard(page_index_lock);
+	if (offset_indexes.emplace(offset, std::move(index)).second) {
+		page_index_size += encoded_size;
+	}
+}
+
+void ParquetFileMetadataCache::AddColumnIndex(int64_t offset, idx_t encoded_size,
+                                              shared_ptr<const duckdb_parquet::format::ColumnIndex> index) {
+	lock_guard<mutex> guard(page_index_lock);
+	if (column_indexes.emplace(offset, std::move(index)).second) {
+		page_index_size += encoded_size;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// ParquetMetadataCache
+//===--------------------------------------------------------------------===//
+//! Identifies (and versions) the file format of a persisted metadata cache
+static constexpr const char *PERSISTED_CACHE_MAGIC = "PQMC0001";
+static constexpr idx_t PERSISTED_CACHE_MAGIC_SIZE = 8;
+
+ParquetMetadataCache::ParquetMetadataCache() : size_limit(NumericLimits<idx_t>::Maximum()) {
+}
+
+ParquetMetadataCache::~ParquetMetadataCache() {
+	try {
+		Save();
+	} catch (...) { // NOLINT
+		// the cache is only persisted on a best-effort basis
+	}
+}
+
+shared_ptr<ParquetMetadataCache> ParquetMetadataCache::Get(ClientContext &context) {
+	Value setting;
+	bool enabled = ObjectCache::ObjectCacheEnabled(context);
+	if (!enabled && context.TryGetCurrentSetting("enable_parquet_metadata_cache", setting) && !setting.IsNull()) {
+		enabled = BooleanValue::Get(setting);
+	}
+	if (!enabled) {
+		return nullptr;
+	}
+	idx_t size_limit = NumericLimits<idx_t>::Maximum();
+	if (context.TryGetCurrentSetting("parquet_metadata_cache_size", setting) && !setting.IsNull()) {
+		size_limit = DBConfig::ParseMemoryLimit(setting.ToString());
+	}
+	string path;
+	if (context.TryGetCurrentSetting("parquet_metadata_cache_path", setting) && !setting.IsNull()) {
+		path = setting.ToString();
+	}
+	auto cache = ObjectCache::GetObjectCache(context).GetOrCreate<ParquetMetadataCache>(ObjectType());
+	if (!cache) {
+		return nullptr;
+	}
+	cache->Configure(context, size_limit, path);
+	return cache;
+}
+
+void ParquetMetadataCache::Configure(ClientContext &context, idx_t size_limit_p, const string &path) {
+	lock_guard<mutex> guard(lock);
+	if (path != persist_path) {
+		persist_path = path;
+		if (!persist_path.empty()) {
+			LoadInternal(context);
+		}
+	}
+	if (size_limit_p != size_limit) {
+		size_limit = size_limit_p;
+		EvictInternal();
+	}
+}
+
+shared_ptr<ParquetFileMetadataCache> ParquetMetadataCache::Lookup(const string &path, time_t last_modified,
+                                                                  idx_t file_size) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(path);
+	if (entry == entries.end() || !entry->second.metadata->IsValid(last_modified, file_size)) {
+		misses++;
+		return nullptr;
+	}
+	hits++;
+	lru.splice(lru.begin(), lru, entry->second.lru_position);
+	return entry->second.metadata;
+}
+
+shared_ptr<ParquetFileMetadataCache> ParquetMetadataCache::LookupUnchecked(const string &path) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(path);
+	if (entry == entries.end()) {
+		return nullptr;
+	}
+	return entry->second.metadata;
+}
+
+void ParquetMetadataCache::Insert(const string &path, shared_ptr<ParquetFileMetadataCache> metadata) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(path);
+	if (entry != entries.end()) {
+		entry->second.metadata = std::move(metadata);
+		lru.splice(lru.begin(), lru, entry->second.lru_position);
+	} else {
+		lru.push_front(path);
+		entries[path] = ParquetMetadataCacheEntry {std::move(metadata), lru.begin()};
+	}
+	modified = true;
+	EvictInternal();
+}
+
+void ParquetMetadataCache::EvictInternal() {
+	if (size_limit == NumericLimits<idx_t>::Maximum()) {
+		return;
+	}
+	// page indexes are added to cached entries while they are in use, so we recompute the total size here
+	idx_t total_size = 0;
+	for (auto &entry : entries) {
+		total_size += entry.second.metadata->EstimatedSize();
+	}
+	while (total_size > size_limit && !lru.empty()) {
+		auto entry = entries.find(lru.back());
+		D_ASSERT(entry != entries.end());
+		total_size -= entry->second.metadata->EstimatedSize();
+		entries.erase(entry);
+		lru.pop_back();
+		evictions++;
+	}
+}
+
+void ParquetMetadataCache::LoadInternal(ClientContext &context) {
+	auto fs = FileSystem::CreateLocal();
+	if (!fs->FileExists(persist_path)) {
+		return;
+	}
+	try {
+		auto handle = fs->OpenFile(persist_path, FileFlags::FILE_FLAGS_READ);
+		auto file_size = NumericCast<idx_t>(handle->GetFileSize());
+		auto buffer = make_unsafe_uniq_array<data_t>(file_size);
+		handle->Read(buffer.get(), file_size);
+
+		MemoryStream stream(buffer.get(), file_size);
+		char magic[PERSISTED_CACHE_MAGIC_SIZE];
+		stream.ReadData(data_ptr_cast(magic), PERSISTED_CACHE_MAGIC_SIZE);
+		if (memcmp(magic, PERSISTED_CACHE_MAGIC, PERSISTED_CACHE_MAGIC_SIZE) != 0) {
+			return;
+		}
+		auto entry_count = stream.Read<uint64_t>();
+		for (idx_t entry_idx = 0; entry_idx < entry_count; entry_idx++) {
+			auto path_length = stream.Read<uint32_t>();
+			string path(path_length, '\0');
+			stream.ReadData(data_ptr_cast(&path[0]), path_length);
+			auto last_modified = stream.Read<int64_t>();
+			auto cached_file_size = stream.Read<uint64_t>();
+			auto read_time = stream.Read<int64_t>();
+			auto footer_size = stream.Read<uint32_t>();
+			auto footer = make_unsafe_uniq_array<data_t>(footer_size);
+			stream.ReadData(footer.get(), footer_size);
+			auto transport = std::make_shared<TMemoryBuffer>(footer.get(), footer_size);
+			TCompactProtocolT<TMemoryBuffer> protocol(transport);
+			auto file_metadata = make_uniq<duckdb_parquet::format::FileMetaData>();
+			file_metadata->read(&protocol);
+
+			if (entries.find(path) != entries.end()) {
+				// the metadata that was read by this database is at least as recent
+				continue;
+			}
+			auto geo_metadata = GeoParquetFileMetadata::TryRead(*file_metadata, context);
+			auto metadata = make_shared_ptr<ParquetFileMetadataCache>(
+			    std::move(file_metadata), static_cast<time_t>(read_time), std::move(geo_metadata));
+			metadata->last_modified = static_cast<time_t>(last_modified);
+			metadata->file_size = cached_file_size;
+			metadata->footer_size = footer_size;
+			// the file is written from the least to the most recently used entry
+			lru.push_front(path);
+			entries[path] = ParquetMetadataCacheEntry {std::move(metadata), lru.begin()};
+		}
+	} catch (std::exception &) { // NOLINT
+		// a corrupt or incompatible file only means that the cache starts out (partially) cold
+	}
+	EvictInternal();
+}
+
+void ParquetMetadataCache::Save() {
+	lock_guard<mutex> guard(lock);
+	if (persist_path.empty() || !modified) {
+		return;
+	}
+	MemoryStream stream;
+	stream.WriteData(const_data_ptr_cast(PERSISTED_CACHE_MAGIC), PERSISTED_CACHE_MAGIC_SIZE);
+	uint64_t entry_count = 0;
+	for (auto &path : lru) {
+		// decrypted footers are never written to disk
+		entry_count += !entries[path].metadata->footer_encrypted;
+	}
+	stream.Write<uint64_t>(entry_count);
+	for (auto it = lru.rbegin(); it != lru.rend(); it++) {
+		auto &path = *it;
+		auto &metadata = *entries[path].metadata;
+		if (metadata.footer_encrypted) {
+			continue;
+		}
+		auto transport = std::make_shared<TMemoryBuffer>();
+		TCompactProtocolT<TMemoryBuffer> protocol(transport);
+		metadata.metadata->write(&protocol);
+		uint8_t *footer;
+		uint32_t footer_size;
+		transport->getBuffer(&footer, &footer_size);
+
+		stream.Write<uint32_t>(NumericCast<uint32_t>(path.size()));
+		stream.WriteData(const_data_ptr_cast(path.c_str()), path.size());
+		stream.Write<int64_t>(static_cast<int64_t>(metadata.last_modified));
+		stream.Write<uint64_t>(metadata.file_size);
+		stream.Write<int64_t>(static_cast<int64_t>(metadata.read_time));
+		stream.Write<uint32_t>(footer_size);
+		stream.WriteData(footer, footer_size);
+	}
+
+	// write to a temporary file first, so a crash never leaves a partially written cache behind
+	auto fs = FileSystem::CreateLocal();
+	auto temp_path = persist_path + ".tmp";
+	{
+		auto handle = fs->OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+		handle->Write(stream.GetData(), stream.GetPosition());
+		handle->Sync();
+	}
+	fs->MoveFile(temp_path, persist_path);
+	modified = false;
+}
+
+idx_t ParquetMetadataCache::EntryCount() {
+	lock_guard<mutex> guard(lock);
+	return entries.size();
+}
+
+idx_t ParquetMetadataCache::EstimatedSize() {
+	lock_guard<mutex> guard(lock);
+	idx_t total_size = 0;
+	for (auto &entry : entries) {
+		total_size += entry.second.metadata->EstimatedSize();
+	}
+	return total_size;
+}
+
+idx_t ParquetMetadataCache::SizeLimit() {
+	lock_guard<mutex> guard(lock);
+	return size_limit;
+}
+
+idx_t ParquetMetadataCache::Hits() {
+	lock_guard<mutex> guard(lock);
+	return hits;
+}
+
+idx_t ParquetMetadataCache::Misses() {
+	lock_guard<mutex> guard(lock);
+	return misses;
+}
+
+idx_t ParquetMetadataCache::Evictions() {
+	lock_guard<mutex> guard(lock);
+	return evictions;
+}
+
+//===--------------------------------------------------------------------===//
+// parquet_metadata_cache
+//===--------------------------------------------------------------------===//
+struct ParquetMetadataCacheData : public GlobalTableFunctionState {
+	bool finished = false;
+};
+
+static unique_ptr<FunctionData> ParquetMetadataCacheBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("enabled");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+
+	names.emplace_back("entries");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_usage_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_limit_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("evictions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+static unique_ptr<GlobalTableFunctionState> ParquetMetadataCacheInit(ClientContext &context,
+                                                                     TableFunctionInitInput &input) {
+	return make_uniq<ParquetMetadataCacheData>();
+}
+
+static Value CacheStatistic(idx_t value) {
+	if (value == NumericLimits<idx_t>::Maximum()) {
+		return Value(LogicalType::BIGINT);
+	}
+	return Value::BIGINT(NumericCast<int64_t>(value));
+}
+
+static void ParquetMetadataCacheImplementation(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<ParquetMetadataCacheData>();
+	if (data.finished) {
+		return;
+	}
+	data.finished = true;
+
+	auto cache = ParquetMetadataCache::Get(context);
+	idx_t col = 0;
+	// enabled, BOOLEAN
+	output.SetValue(col++, 0, Value::BOOLEAN(cache != nullptr));
+	// entries, BIGINT
+	output.SetValue(col++, 0, CacheStatistic(cache ? cache->EntryCount() : 0));
+	// memory_usage_bytes, BIGINT
+	output.SetValue(col++, 0, CacheStatistic(cache ? cache->EstimatedSize() : 0));
+	// memory_limit_bytes, BIGINT (NULL if there is no limit)
+	output.SetValue(col++, 0, CacheStatistic(cache ? cache->SizeLimit() : 0));
+	// hits, BIGINT
+	output.SetValue(col++, 0, CacheStatistic(cache ? cache->Hits() : 0));
+	// misses, BIGINT
+	output.SetValue(col++, 0, CacheStatistic(cache ? cache->Misses() : 0));
+	// evictions, BIGINT
+	output.SetValue(col++, 0, CacheStatistic(cache ? cache->Evictions() : 0));
+	output.SetCardinality(1);
+}
+
+ParquetMetadataCacheFunction::ParquetMetadataCacheFunction()
+    : TableFunction("parquet_metadata_cache", {}, ParquetMetadataCacheImplementation, ParquetMetadataCacheBind,
+                    ParquetMetadataCacheInit) {
+}
+
+} // namespace duckdb
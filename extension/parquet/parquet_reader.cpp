@@ -18,6 +18,7 @@
 #include "struct_column_reader.hpp"
 #include "templated_column_reader.hpp"
 #include "thrift_tools.hpp"
+#include "utf8proc_wrapper.hpp"
 #include "duckdb/main/config.hpp"
 
 #ifndef DUCKDB_AMALGAMATION
@@ -26,8 +27,11 @@
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/object_cache.hpp"
@@ -119,7 +123,10 @@ LoadMetadata(ClientContext &context, Allocator &allocator, FileHandle &file_hand
 	// Try to read the GeoParquet metadata (if present)
 	auto geo_metadata = GeoParquetFileMetadata::TryRead(*metadata, context);
 
-	return make_shared_ptr<ParquetFileMetadataCache>(std::move(metadata), current_time, std::move(geo_metadata));
+	auto result = make_shared_ptr<ParquetFileMetadataCache>(std::move(metadata), current_time, std::move(geo_metadata));
+	result->footer_size = footer_len;
+	result->footer_encrypted = footer_encrypted;
+	return result;
 }
 
 LogicalType ParquetReader::DeriveLogicalType(const SchemaElement &s_ele, bool binary_as_string) {
@@ -538,20 +545,24 @@ ParquetReader::ParquetReader(ClientContext &context_p, string file_name_p, Parqu
 		encryption_util = make_shared_ptr<duckdb_mbedtls::MbedTlsWrapper::AESGCMStateMBEDTLSFactory>();
 	}
 
-	// If object cached is disabled
-	// or if this file has cached metadata
+	// If the metadata cache is disabled
+	// or if this file has no cached metadata
 	// or if the cached version already expired
 	if (!metadata_p) {
-		if (!ObjectCache::ObjectCacheEnabled(context_p)) {
+		auto metadata_cache = ParquetMetadataCache::Get(context_p);
+		if (!metadata_cache) {
 			metadata =
 			    LoadMetadata(context_p, allocator, *file_handle, parquet_options.encryption_config, *encryption_util);
 		} else {
 			auto last_modify_time = fs.GetLastModifiedTime(*file_handle);
-			metadata = ObjectCache::GetObjectCache(context_p).Get<ParquetFileMetadataCache>(file_name);
-			if (!metadata || (last_modify_time + 10 >= metadata->read_time)) {
+			auto file_size = NumericCast<idx_t>(file_handle->GetFileSize());
+			metadata = metadata_cache->Lookup(file_name, last_modify_time, file_size);
+			if (!metadata) {
 				metadata = LoadMetadata(context_p, allocator, *file_handle, parquet_options.encryption_config,
 				                        *encryption_util);
-				ObjectCache::GetObjectCache(context_p).Put(file_name, metadata);
+				metadata->last_modified = last_modify_time;
+				metadata->file_size = file_size;
+				metadata_cache->Insert(file_name, metadata);
 			}
 		}
 	} else {
@@ -703,8 +714,8 @@ idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
 	return min_offset;
 }
 
-static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, const Statistics &pq_col_stats,
-                                                      TableFilter &filter) {
+static FilterPropagateResult CheckParquetStringComparison(BaseStatistics &stats, const Statistics &pq_col_stats,
+                                                          TableFilter &filter) {
 	if (filter.filter_type == TableFilterType::CONSTANT_COMPARISON) {
 		auto &constant_filter = filter.Cast<ConstantFilter>();
 		auto &min_value = pq_col_stats.min_value;
@@ -717,6 +728,30 @@ static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, con
 	}
 }
 
+static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, const Statistics &pq_col_stats,
+                                                      TableFilter &filter) {
+	if (!pq_col_stats.__isset.min_value || !pq_col_stats.__isset.max_value) {
+		return filter.CheckStatistics(stats);
+	}
+	// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
+	// however, when reading remote Parquet files, skipping row groups is really important
+	// here, we implement a special case to check the full length for string filters
+	if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
+		const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
+		for (auto &child_filter : and_filter.child_filters) {
+			auto child_prune_result = CheckParquetStringComparison(stats, pq_col_stats, *child_filter);
+			if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+			} else if (child_prune_result != and_result) {
+				and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return and_result;
+	}
+	return CheckParquetStringComparison(stats, pq_col_stats, filter);
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t col_idx) {
 	auto &group = GetGroup(state);
 	auto column_id = reader_data.column_ids[col_idx];
@@ -728,41 +763,31 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 		// filters contain output chunk index, not file col idx!
 		auto global_id = reader_data.column_mapping[col_idx];
 		auto filter_entry = reader_data.filters->filters.find(global_id);
+		if (filter_entry != reader_data.filters->filters.end()) {
+			// dictionary-encoded pages of this column evaluate the filter once per dictionary entry
+			column_reader->SetDictionaryFilter(filter_entry->second.get());
+		}
+		if (!stats && filter_entry != reader_data.filters->filters.end()) {
+			state.page_filter_columns.push_back(col_idx);
+		}
 		if (stats && filter_entry != reader_data.filters->filters.end()) {
 			bool skip_chunk = false;
 			auto &filter = *filter_entry->second;
 
 			FilterPropagateResult prune_result;
-			if (column_reader->Type().id() == LogicalTypeId::VARCHAR &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.min_value &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.max_value) {
-				// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
-				// however, when reading remote Parquet files, skipping row groups is really important
-				// here, we implement a special case to check the full length for string filters
-				if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
-					const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
-					auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
-					for (auto &child_filter : and_filter.child_filters) {
-						auto child_prune_result = CheckParquetStringFilter(
-						    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, *child_filter);
-						if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-							and_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
-							break;
-						} else if (child_prune_result != and_result) {
-							and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
-						}
-					}
-					prune_result = and_result;
-				} else {
-					prune_result = CheckParquetStringFilter(
-					    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, filter);
-				}
+			if (column_reader->Type().id() == LogicalTypeId::VARCHAR) {
+				auto &pq_col_stats = group.columns[column_reader->FileIdx()].meta_data.statistics;
+				prune_result = CheckParquetStringFilter(*stats, pq_col_stats, filter);
 			} else {
 				prune_result = filter.CheckStatistics(*stats);
 			}
-
 			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
 				skip_chunk = true;
+			} else if (prune_result == FilterPropagateResult::NO_PRUNING_POSSIBLE) {
+				skip_chunk = BloomFilterExcludes(state, *column_reader, filter);
+				if (!skip_chunk) {
+					state.page_filter_columns.push_back(col_idx);
+				}
 			}
 			if (skip_chunk) {
 				// this effectively will skip this chunk
@@ -776,6 +801,196 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+bool ParquetReader::BloomFilterExcludes(ParquetReaderScanState &state, const ColumnReader &column_reader,
+                                        const TableFilter &filter) {
+	// nested columns do not have a column chunk (and Bloom filter) of their own
+	if (column_reader.Type().IsNested() || !ParquetStatisticsUtils::BloomFilterSupported(column_reader, filter)) {
+		return false;
+	}
+	auto &column_chunk = GetGroup(state).columns[column_reader.FileIdx()];
+	if (!column_chunk.__isset.meta_data || !column_chunk.meta_data.__isset.bloom_filter_offset ||
+	    parquet_options.encryption_config) {
+		return false;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	auto bloom_filter_offset = column_chunk.meta_data.bloom_filter_offset;
+	if (bloom_filter_offset <= 0 || NumericCast<idx_t>(bloom_filter_offset) >= trans.GetSize()) {
+		return false;
+	}
+	trans.SetLocation(NumericCast<idx_t>(bloom_filter_offset));
+	duckdb_parquet::format::BloomFilterHeader header;
+	Read(header, *state.thrift_file_proto);
+	// we only understand the (currently only) algorithm, hash and compression defined by the format
+	if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED) {
+		return false;
+	}
+	if (header.numBytes <= 0 || header.numBytes % ParquetBloomFilter::BYTES_PER_BLOCK != 0 ||
+	    NumericCast<idx_t>(header.numBytes) > ParquetBloomFilter::MAX_BYTES ||
+	    trans.GetLocation() + NumericCast<idx_t>(header.numBytes) > trans.GetSize()) {
+		return false;
+	}
+	ParquetBloomFilter bloom_filter(NumericCast<idx_t>(header.numBytes));
+	ReadData(*state.thrift_file_proto, bloom_filter.Data(), NumericCast<uint32_t>(header.numBytes));
+	return ParquetStatisticsUtils::BloomFilterExcludes(column_reader, filter, bloom_filter);
+}
+
+void ParquetReader::PrefetchPageIndexes(ParquetReaderScanState &state, const vector<idx_t> &column_indexes,
+                                        bool read_column_index) {
+	if (!state.prefetch_mode || parquet_options.encryption_config) {
+		return;
+	}
+	auto &group = GetGroup(state);
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	auto file_size = trans.GetSize();
+	bool registered = false;
+	for (auto &col_idx : column_indexes) {
+		auto column_reader = root_reader.GetChildReader(reader_data.column_ids[col_idx]);
+		if (column_reader->Type().IsNested() || column_reader->FileIdx() >= group.columns.size()) {
+			// nested columns have no page index, generated columns (e.g. file_row_number) have no column chunk
+			continue;
+		}
+		auto &column_chunk = group.columns[column_reader->FileIdx()];
+		auto register_index = [&](int64_t offset, int32_t length) {
+			if (offset <= 0 || length <= 0 || NumericCast<idx_t>(offset) + NumericCast<idx_t>(length) > file_size) {
+				return;
+			}
+			trans.RegisterPrefetch(NumericCast<idx_t>(offset), NumericCast<idx_t>(length));
+			registered = true;
+		};
+		if (column_chunk.__isset.offset_index_offset && column_chunk.__isset.offset_index_length &&
+		    !metadata->GetOffsetIndex(column_chunk.offset_index_offset)) {
+			register_index(column_chunk.offset_index_offset, column_chunk.offset_index_length);
+		}
+		if (read_column_index && column_chunk.__isset.column_index_offset &&
+		    column_chunk.__isset.column_index_length && !metadata->GetColumnIndex(column_chunk.column_index_offset)) {
+			register_index(column_chunk.column_index_offset, column_chunk.column_index_length);
+		}
+	}
+	if (registered) {
+		// the page indexes of all columns are stored together, so this is usually a single read
+		trans.FinalizeRegistration();
+		trans.PrefetchRegistered();
+	}
+}
+
+void ParquetReader::PrunePages(ParquetReaderScanState &state) {
+	state.skipped_rows.clear();
+	state.skipped_rows_idx = 0;
+	auto &group = GetGroup(state);
+	auto group_rows = NumericCast<idx_t>(group.num_rows);
+	if (state.group_offset == group_rows) {
+		state.page_filter_columns.clear();
+		return;
+	}
+	// skip the rows outside of the range that is scanned, if the row group is split over multiple scans
+	if (state.group_row_start > 0) {
+		state.skipped_rows.push_back(ParquetRowRange {0, MinValue<idx_t>(state.group_row_start, group_rows)});
+	}
+	if (state.group_row_end < group_rows) {
+		state.skipped_rows.push_back(ParquetRowRange {state.group_row_end, group_rows});
+	}
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	// the page index is only read for the filters that the row group statistics could not decide
+	PrefetchPageIndexes(state, state.page_filter_columns, true);
+	for (auto &col_idx : state.page_filter_columns) {
+		auto filter_entry = reader_data.filters->filters.find(reader_data.column_mapping[col_idx]);
+		D_ASSERT(filter_entry != reader_data.filters->filters.end());
+		auto column_reader = root_reader.GetChildReader(reader_data.column_ids[col_idx]);
+		if (!column_reader->CanSkipPages()) {
+			continue;
+		}
+		auto &column_chunk = group.columns[column_reader->FileIdx()];
+		if (!column_chunk.__isset.column_index_offset) {
+			continue;
+		}
+		// page indexes are cached together with the file metadata
+		auto column_index_ptr = metadata->GetColumnIndex(column_chunk.column_index_offset);
+		if (!column_index_ptr) {
+			auto read_index = make_shared_ptr<duckdb_parquet::format::ColumnIndex>();
+			trans.SetLocation(NumericCast<idx_t>(column_chunk.column_index_offset));
+			Read(*read_index, *state.thrift_file_proto);
+			auto encoded_size = NumericCast<idx_t>(MaxValue<int32_t>(column_chunk.column_index_length, 0));
+			metadata->AddColumnIndex(column_chunk.column_index_offset, encoded_size, read_index);
+			column_index_ptr = std::move(read_index);
+		}
+		auto &column_index = *column_index_ptr;
+
+		auto &page_locations = column_reader->GetPageLocations();
+		const auto page_count = page_locations.size();
+		if (column_index.null_pages.size() != page_count || column_index.min_values.size() != page_count ||
+		    column_index.max_values.size() != page_count) {
+			continue; // malformed page index
+		}
+		auto &filter = *filter_entry->second;
+		for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+			if (column_index.null_pages[page_idx]) {
+				continue;
+			}
+			auto &min_value = column_index.min_values[page_idx];
+			auto &max_value = column_index.max_values[page_idx];
+			if (column_reader->Type().id() == LogicalTypeId::VARCHAR &&
+			    (Utf8Proc::Analyze(min_value.c_str(), min_value.size()) == UnicodeType::INVALID ||
+			     Utf8Proc::Analyze(max_value.c_str(), max_value.size()) == UnicodeType::INVALID)) {
+				continue; // writers can truncate the values in the page index in the middle of a character
+			}
+			Statistics page_stats;
+			page_stats.__set_min_value(min_value);
+			page_stats.__set_max_value(max_value);
+			if (column_index.__isset.null_counts && column_index.null_counts.size() == page_count) {
+				page_stats.__set_null_count(column_index.null_counts[page_idx]);
+			}
+			auto stats = ParquetStatisticsUtils::TransformColumnStatistics(*column_reader, page_stats);
+			if (!stats) {
+				break;
+			}
+			FilterPropagateResult prune_result;
+			if (column_reader->Type().id() == LogicalTypeId::VARCHAR) {
+				prune_result = CheckParquetStringFilter(*stats, page_stats, filter);
+			} else {
+				prune_result = filter.CheckStatistics(*stats);
+			}
+			if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				continue;
+			}
+			ParquetRowRange range;
+			range.start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+			range.end = page_idx + 1 < page_count ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+			                                      : NumericCast<idx_t>(group.num_rows);
+			state.skipped_rows.push_back(range);
+		}
+	}
+	state.page_filter_columns.clear();
+	if (state.skipped_rows.empty()) {
+		return;
+	}
+
+	// sort the ranges and merge the ones that overlap or are adjacent
+	std::sort(state.skipped_rows.begin(), state.skipped_rows.end(),
+	          [](const ParquetRowRange &a, const ParquetRowRange &b) { return a.start < b.start; });
+	idx_t merged_count = 0;
+	for (auto &range : state.skipped_rows) {
+		if (merged_count > 0 && range.start <= state.skipped_rows[merged_count - 1].end) {
+			auto &last = state.skipped_rows[merged_count - 1];
+			last.end = MaxValue(last.end, range.end);
+		} else {
+			state.skipped_rows[merged_count++] = range;
+		}
+	}
+	state.skipped_rows.resize(merged_count);
+
+	// read the page locations of all columns before anything is registered for prefetching
+	vector<idx_t> all_columns;
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		all_columns.push_back(col_idx);
+	}
+	PrefetchPageIndexes(state, all_columns, false);
+	for (auto &col_idx : all_columns) {
+		root_reader.GetChildReader(reader_data.column_ids[col_idx])->CanSkipPages();
+	}
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -784,12 +999,36 @@ idx_t ParquetReader::NumRowGroups() {
 	return GetFileMetadata()->row_groups.size();
 }
 
+idx_t ParquetReader::RowGroupSplitCount(idx_t group_idx) {
+	auto file_meta_data = GetFileMetadata();
+	auto &group = file_meta_data->row_groups[group_idx];
+	auto group_rows = NumericCast<idx_t>(group.num_rows);
+	if (group_rows <= ROW_GROUP_SPLIT_SIZE || parquet_options.encryption_config) {
+		return 1;
+	}
+	// every scan has to skip to the start of its range: only split if all columns can skip pages using the page index
+	for (auto &column : group.columns) {
+		if (!column.__isset.offset_index_offset) {
+			return 1;
+		}
+	}
+	for (auto &schema_element : file_meta_data->schema) {
+		if (schema_element.__isset.repetition_type &&
+		    schema_element.repetition_type == FieldRepetitionType::REPEATED) {
+			return 1;
+		}
+	}
+	return (group_rows + ROW_GROUP_SPLIT_SIZE - 1) / ROW_GROUP_SPLIT_SIZE;
+}
+
 void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanState &state,
                                    vector<idx_t> groups_to_read) {
 	state.current_group = -1;
 	state.finished = false;
 	state.group_offset = 0;
 	state.group_idx_list = std::move(groups_to_read);
+	state.group_row_start = 0;
+	state.group_row_end = NumericLimits<idx_t>::Maximum();
 	state.sel.Initialize(STANDARD_VECTOR_SIZE);
 	if (!state.file_handle || state.file_handle->path != file_handle->path) {
 		auto flags = FileFlags::FILE_FLAGS_READ;
@@ -852,6 +1091,28 @@ void FilterIsNotNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
 	}
 }
 
+template <class FILTER>
+void FilterSelection(Vector &v, const FILTER &filter, parquet_filter_t &filter_mask, idx_t count) {
+	if (filter_mask.none() || count == 0) {
+		return;
+	}
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	idx_t approved_tuple_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			sel.set_index(approved_tuple_count++, i);
+		}
+	}
+	UnifiedVectorFormat vdata;
+	v.ToUnifiedFormat(count, vdata);
+	filter.Filter(v, vdata, sel, approved_tuple_count);
+
+	filter_mask.reset();
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		filter_mask.set(sel.get_index(i));
+	}
+}
+
 template <class T, class OP>
 void TemplatedFilterOperation(Vector &v, T constant, parquet_filter_t &filter_mask, idx_t count) {
 	if (v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
@@ -940,7 +1201,7 @@ static void FilterOperationSwitch(Vector &v, Value &constant, parquet_filter_t &
 	}
 }
 
-static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
+void ParquetReader::ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_AND: {
 		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
@@ -989,6 +1250,22 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 	case TableFilterType::IS_NULL:
 		FilterIsNull(v, filter_mask, count);
 		break;
+	case TableFilterType::BLOOM_FILTER:
+		FilterSelection(v, filter.Cast<BloomFilter>(), filter_mask, count);
+		break;
+	case TableFilterType::IN_FILTER:
+		FilterSelection(v, filter.Cast<InFilter>(), filter_mask, count);
+		break;
+	case TableFilterType::DYNAMIC_FILTER: {
+		// the filter can only become more selective, so results that were cached for an earlier value (e.g. per
+		// dictionary entry) are a superset of the rows that pass now
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		lock_guard<mutex> guard(dynamic_filter.filter_data->lock);
+		if (dynamic_filter.filter_data->initialized) {
+			ApplyFilter(v, *dynamic_filter.filter_data->filter, filter_mask, count);
+		}
+		break;
+	}
 	case TableFilterType::STRUCT_EXTRACT: {
 		auto &struct_filter = filter.Cast<StructFilter>();
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
@@ -1037,6 +1314,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx)->TotalCompressedSize();
 		}
+		PrunePages(state);
 
 		auto &group = GetGroup(state);
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
@@ -1050,7 +1328,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 				    "Malformed parquet file: sum of total compressed bytes of columns seems incorrect");
 			}
 
-			if (!reader_data.filters &&
+			if (!reader_data.filters && state.skipped_rows.empty() &&
 			    scan_percentage > ParquetReaderPrefetchConfig::WHOLE_GROUP_PREFETCH_MINIMUM_SCAN) {
 				// Prefetch the whole row group
 				if (!state.current_group_prefetched) {
@@ -1075,7 +1353,14 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 						auto entry = reader_data.filters->filters.find(reader_data.column_mapping[col_idx]);
 						has_filter = entry != reader_data.filters->filters.end();
 					}
-					root_reader.GetChildReader(file_col_idx)->RegisterPrefetch(trans, !(lazy_fetch && !has_filter));
+					auto child_reader = root_reader.GetChildReader(file_col_idx);
+					auto allow_merge = !(lazy_fetch && !has_filter);
+					if (!state.skipped_rows.empty() && child_reader->CanSkipPages()) {
+						// only fetch the pages that contain rows we are going to read
+						child_reader->RegisterPagePrefetch(trans, allow_merge, state.skipped_rows);
+					} else {
+						child_reader->RegisterPrefetch(trans, allow_merge);
+					}
 				}
 
 				trans.FinalizeRegistration();
@@ -1088,7 +1373,29 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
-	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
+	// skip over the rows in pages that were pruned using the page index
+	idx_t rows_until_skip = STANDARD_VECTOR_SIZE;
+	while (state.skipped_rows_idx < state.skipped_rows.size()) {
+		auto &range = state.skipped_rows[state.skipped_rows_idx];
+		if (range.start > state.group_offset) {
+			// read up to the start of the next skipped range
+			rows_until_skip = MinValue<idx_t>(rows_until_skip, range.start - state.group_offset);
+			break;
+		}
+		state.skipped_rows_idx++;
+		if (range.end <= state.group_offset) {
+			continue;
+		}
+		auto skip_count = range.end - state.group_offset;
+		auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+		for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+			root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(skip_count);
+		}
+		state.group_offset = range.end;
+		return true;
+	}
+
+	auto this_output_chunk_rows = MinValue<idx_t>(rows_until_skip, GetGroup(state).num_rows - state.group_offset);
 	result.SetCardinality(this_output_chunk_rows);
 
 	if (this_output_chunk_rows == 0) {
@@ -5,16 +5,21 @@
 #include "parquet_timestamp.hpp"
 #include "string_column_reader.hpp"
 #include "struct_column_reader.hpp"
+#include "zstd/common/xxhash.h"
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/types/blob.hpp"
 #include "duckdb/common/types/time.hpp"
 #include "duckdb/common/types/value.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/storage/statistics/struct_stats.hpp"
 #endif
 
 namespace duckdb {
 
 using duckdb_parquet::format::ConvertedType;
+using duckdb_parquet::format::Statistics;
 using duckdb_parquet::format::Type;
 
 static unique_ptr<BaseStatistics> CreateNumericStats(const LogicalType &type,
@@ -320,7 +325,12 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		// no stats present for row group
 		return nullptr;
 	}
-	auto &parquet_stats = column_chunk.meta_data.statistics;
+	return TransformColumnStatistics(reader, column_chunk.meta_data.statistics);
+}
+
+unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(const ColumnReader &reader,
+                                                                             const Statistics &parquet_stats) {
+	unique_ptr<BaseStatistics> row_group_stats;
 
 	auto &type = reader.Type();
 	auto &s_ele = reader.Schema();
@@ -387,4 +397,200 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 	return row_group_stats;
 }
 
+//===--------------------------------------------------------------------===//
+// Bloom Filters
+//===--------------------------------------------------------------------===//
+//! The salt used to derive the eight bit positions of a value within a block, as specified by the Parquet format
+static constexpr const uint32_t BLOOM_FILTER_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                         0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+static constexpr const idx_t BLOOM_FILTER_WORDS_PER_BLOCK = 8;
+
+static idx_t BloomFilterSize(idx_t distinct_count, double false_positive_ratio) {
+	D_ASSERT(false_positive_ratio > 0 && false_positive_ratio < 1);
+	// every value sets eight bits - the required number of bits follows from the target false positive ratio
+	auto bits = -8.0 * static_cast<double>(MaxValue<idx_t>(distinct_count, 1)) /
+	            std::log(1.0 - std::pow(false_positive_ratio, 1.0 / 8.0));
+	auto bytes = static_cast<double>(ParquetBloomFilter::BYTES_PER_BLOCK) *
+	             std::ceil(bits / (8.0 * static_cast<double>(ParquetBloomFilter::BYTES_PER_BLOCK)));
+	if (bytes >= static_cast<double>(ParquetBloomFilter::MAX_BYTES)) {
+		return ParquetBloomFilter::MAX_BYTES;
+	}
+	return MaxValue<idx_t>(static_cast<idx_t>(bytes), ParquetBloomFilter::BYTES_PER_BLOCK);
+}
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t distinct_count, double false_positive_ratio)
+    : ParquetBloomFilter(BloomFilterSize(distinct_count, false_positive_ratio)) {
+}
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_bytes) {
+	D_ASSERT(num_bytes > 0 && num_bytes % BYTES_PER_BLOCK == 0);
+	bitset.resize(num_bytes / sizeof(uint32_t), 0);
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+void ParquetBloomFilter::Insert(uint64_t hash) {
+	// the upper 32 bits select the block, the lower 32 bits the bits within the block
+	const auto block_count = bitset.size() / BLOOM_FILTER_WORDS_PER_BLOCK;
+	const auto block_idx = ((hash >> 32) * block_count) >> 32;
+	const auto key = static_cast<uint32_t>(hash);
+	auto block = bitset.data() + block_idx * BLOOM_FILTER_WORDS_PER_BLOCK;
+	for (idx_t i = 0; i < BLOOM_FILTER_WORDS_PER_BLOCK; i++) {
+		block[i] |= 1U << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::Contains(uint64_t hash) const {
+	const auto block_count = bitset.size() / BLOOM_FILTER_WORDS_PER_BLOCK;
+	const auto block_idx = ((hash >> 32) * block_count) >> 32;
+	const auto key = static_cast<uint32_t>(hash);
+	auto block = bitset.data() + block_idx * BLOOM_FILTER_WORDS_PER_BLOCK;
+	for (idx_t i = 0; i < BLOOM_FILTER_WORDS_PER_BLOCK; i++) {
+		if (!(block[i] & (1U << ((key * BLOOM_FILTER_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Hashes a constant the same way the value is hashed when it is written: in its plain encoded physical type
+static bool TryHashBloomFilterValue(const ColumnReader &reader, const Value &value, uint64_t &result) {
+	if (value.IsNull() || value.type() != reader.Type()) {
+		return false;
+	}
+	switch (reader.Schema().type) {
+	case Type::INT32:
+		switch (value.type().id()) {
+		case LogicalTypeId::TINYINT:
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+			result = ParquetBloomFilter::Hash(value.GetValue<int32_t>());
+			return true;
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+		case LogicalTypeId::UINTEGER:
+			result = ParquetBloomFilter::Hash(value.GetValue<uint32_t>());
+			return true;
+		case LogicalTypeId::DATE:
+			result = ParquetBloomFilter::Hash(value.GetValue<date_t>().days);
+			return true;
+		default:
+			return false;
+		}
+	case Type::INT64:
+		switch (value.type().id()) {
+		case LogicalTypeId::BIGINT:
+			result = ParquetBloomFilter::Hash(value.GetValue<int64_t>());
+			return true;
+		case LogicalTypeId::UBIGINT:
+			result = ParquetBloomFilter::Hash(value.GetValue<uint64_t>());
+			return true;
+		default:
+			return false;
+		}
+	case Type::BYTE_ARRAY:
+		switch (value.type().id()) {
+		case LogicalTypeId::VARCHAR:
+		case LogicalTypeId::BLOB: {
+			auto &str = StringValue::Get(value);
+			result = ParquetBloomFilter::Hash(const_data_ptr_cast(str.c_str()), str.size());
+			return true;
+		}
+		default:
+			return false;
+		}
+	default:
+		// floating point values are not supported: -0.0 and 0.0 are equal, but have different hashes
+		return false;
+	}
+}
+
+static bool BloomFilterExcludesValue(const ColumnReader &reader, const Value &value,
+                                     const ParquetBloomFilter &bloom_filter) {
+	uint64_t hash;
+	if (!TryHashBloomFilterValue(reader, value, hash)) {
+		return false;
+	}
+	return !bloom_filter.Contains(hash);
+}
+
+bool ParquetStatisticsUtils::BloomFilterSupported(const ColumnReader &reader, const TableFilter &filter) {
+	uint64_t hash;
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		return constant_filter.comparison_type == ExpressionType::COMPARE_EQUAL &&
+		       TryHashBloomFilterValue(reader, constant_filter.constant, hash);
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		return !in_filter.values.empty() && TryHashBloomFilterValue(reader, in_filter.values[0], hash);
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (BloomFilterSupported(reader, *child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!BloomFilterSupported(reader, *child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ParquetStatisticsUtils::BloomFilterExcludes(const ColumnReader &reader, const TableFilter &filter,
+                                                 const ParquetBloomFilter &bloom_filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL) {
+			return false;
+		}
+		return BloomFilterExcludesValue(reader, constant_filter.constant, bloom_filter);
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		for (auto &value : in_filter.values) {
+			if (!BloomFilterExcludesValue(reader, value, bloom_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (BloomFilterExcludes(reader, *child_filter, bloom_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!BloomFilterExcludes(reader, *child_filter, bloom_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
 } // namespace duckdb
@@ -319,11 +319,13 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
                              const vector<pair<string, string>> &kv_metadata,
                              shared_ptr<ParquetEncryptionConfig> encryption_config_p,
                              double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p,
-                             bool debug_use_openssl_p)
+                             bool debug_use_openssl_p, bool write_bloom_filter_p,
+                             double bloom_filter_false_positive_ratio_p)
     : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
       field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
       dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p),
-      debug_use_openssl(debug_use_openssl_p) {
+      debug_use_openssl(debug_use_openssl_p), write_bloom_filter(write_bloom_filter_p),
+      bloom_filter_false_positive_ratio(bloom_filter_false_positive_ratio_p) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -533,7 +535,36 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	FlushRowGroup(prepared_row_group);
 }
 
+void ParquetWriter::BufferBloomFilter(idx_t column_idx, unique_ptr<ParquetBloomFilter> bloom_filter) {
+	// this is called while flushing a row group (i.e. while holding the lock), before the row group is appended
+	ParquetBloomFilterEntry entry;
+	entry.row_group_idx = file_meta_data.row_groups.size();
+	entry.column_idx = column_idx;
+	entry.bloom_filter = std::move(bloom_filter);
+	bloom_filters.push_back(std::move(entry));
+}
+
 void ParquetWriter::Finalize() {
+	// write the Bloom filters before the footer, and point the column chunks to them
+	for (auto &entry : bloom_filters) {
+		auto &column_chunk = file_meta_data.row_groups[entry.row_group_idx].columns[entry.column_idx];
+		auto &bloom_filter = *entry.bloom_filter;
+		const auto bloom_filter_offset = writer->GetTotalWritten();
+
+		duckdb_parquet::format::BloomFilterHeader header;
+		header.numBytes = NumericCast<int32_t>(bloom_filter.SizeInBytes());
+		header.algorithm.__set_BLOCK(duckdb_parquet::format::SplitBlockAlgorithm());
+		header.hash.__set_XXHASH(duckdb_parquet::format::XxHash());
+		header.compression.__set_UNCOMPRESSED(duckdb_parquet::format::BloomFilterUncompressed());
+		Write(header);
+		WriteData(bloom_filter.Data(), NumericCast<uint32_t>(bloom_filter.SizeInBytes()));
+
+		column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(bloom_filter_offset));
+		column_chunk.meta_data.__set_bloom_filter_length(
+		    NumericCast<int32_t>(writer->GetTotalWritten() - bloom_filter_offset));
+	}
+	bloom_filters.clear();
+
 	const auto start_offset = writer->GetTotalWritten();
 	if (encryption_config) {
 		// Crypto metadata is written unencrypted
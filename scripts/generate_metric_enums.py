@@ -22,6 +22,7 @@ metrics = [
     "CUMULATIVE_ROWS_SCANNED",
     "OPERATOR_ROWS_SCANNED",
     "OPERATOR_TIMING",
+    "TASK_TIME",
 ]
 
 phase_timing_metrics = [
@@ -22,6 +22,7 @@
 #include "duckdb/common/enums/cte_materialize.hpp"
 #include "duckdb/common/enums/date_part_specifier.hpp"
 #include "duckdb/common/enums/debug_initialize.hpp"
+#include "duckdb/common/enums/eviction_policy.hpp"
 #include "duckdb/common/enums/explain_format.hpp"
 #include "duckdb/common/enums/expression_type.hpp"
 #include "duckdb/common/enums/file_compression_type.hpp"
@@ -1797,6 +1798,29 @@ ErrorType EnumUtil::FromString<ErrorType>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<EvictionPolicy>(EvictionPolicy value) {
+	switch(value) {
+	case EvictionPolicy::LRU:
+		return "LRU";
+	case EvictionPolicy::TWO_QUEUE:
+		return "TWO_QUEUE";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+EvictionPolicy EnumUtil::FromString<EvictionPolicy>(const char *value) {
+	if (StringUtil::Equals(value, "LRU")) {
+		return EvictionPolicy::LRU;
+	}
+	if (StringUtil::Equals(value, "TWO_QUEUE")) {
+		return EvictionPolicy::TWO_QUEUE;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<ExceptionFormatValueType>(ExceptionFormatValueType value) {
 	switch(value) {
@@ -4355,6 +4379,8 @@ const char* EnumUtil::ToChars<MetricsType>(MetricsType value) {
 		return "OPERATOR_ROWS_SCANNED";
 	case MetricsType::OPERATOR_TIMING:
 		return "OPERATOR_TIMING";
+	case MetricsType::TASK_TIME:
+		return "TASK_TIME";
 	case MetricsType::ALL_OPTIMIZERS:
 		return "ALL_OPTIMIZERS";
 	case MetricsType::CUMULATIVE_OPTIMIZER_TIMING:
@@ -4454,6 +4480,9 @@ MetricsType EnumUtil::FromString<MetricsType>(const char *value) {
 	if (StringUtil::Equals(value, "OPERATOR_TIMING")) {
 		return MetricsType::OPERATOR_TIMING;
 	}
+	if (StringUtil::Equals(value, "TASK_TIME")) {
+		return MetricsType::TASK_TIME;
+	}
 	if (StringUtil::Equals(value, "ALL_OPTIMIZERS")) {
 		return MetricsType::ALL_OPTIMIZERS;
 	}
@@ -7373,6 +7402,12 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::BLOOM_FILTER:
+		return "BLOOM_FILTER";
+	case TableFilterType::IN_FILTER:
+		return "IN_FILTER";
+	case TableFilterType::DYNAMIC_FILTER:
+		return "DYNAMIC_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -7398,6 +7433,15 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "BLOOM_FILTER")) {
+		return TableFilterType::BLOOM_FILTER;
+	}
+	if (StringUtil::Equals(value, "IN_FILTER")) {
+		return TableFilterType::IN_FILTER;
+	}
+	if (StringUtil::Equals(value, "DYNAMIC_FILTER")) {
+		return TableFilterType::DYNAMIC_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
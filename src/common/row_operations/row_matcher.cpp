@@ -47,11 +47,60 @@ static idx_t TemplatedMatchLoop(const TupleDataVectorFormat &lhs_format, Selecti
 	return match_count;
 }
 
+//! (NOT DISTINCT FROM) equality of fixed-width integer keys with a non-NULL LHS, the common case for join and
+//! aggregate keys. Matches are computed without branches, and the selection vectors are filled branch-free as well.
+template <bool NO_MATCH_SEL, class T>
+static idx_t BranchlessEqualityMatchLoop(const TupleDataVectorFormat &lhs_format, SelectionVector &sel,
+                                         const idx_t count, const TupleDataLayout &rhs_layout,
+                                         Vector &rhs_row_locations, const idx_t col_idx, SelectionVector *no_match_sel,
+                                         idx_t &no_match_count) {
+	// LHS
+	const auto &lhs_sel = *lhs_format.unified.sel;
+	const auto lhs_data = UnifiedVectorFormat::GetData<T>(lhs_format.unified);
+
+	// RHS
+	const auto rhs_locations = FlatVector::GetData<data_ptr_t>(rhs_row_locations);
+	const auto rhs_offset_in_row = rhs_layout.GetOffsets()[col_idx];
+	idx_t entry_idx;
+	idx_t idx_in_entry;
+	ValidityBytes::GetEntryIndex(col_idx, entry_idx, idx_in_entry);
+
+	idx_t match_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = sel.get_index(i);
+		const auto lhs_idx = lhs_sel.get_index(idx);
+
+		const auto &rhs_location = rhs_locations[idx];
+		const ValidityBytes rhs_mask(rhs_location);
+		const auto rhs_valid = rhs_mask.RowIsValid(rhs_mask.GetValidityEntryUnsafe(entry_idx), idx_in_entry);
+		const auto rhs_value = Load<T>(rhs_location + rhs_offset_in_row);
+		const idx_t match = rhs_valid & (lhs_data[lhs_idx] == rhs_value);
+
+		// "match_count <= i", so we never overwrite entries of "sel" that we still have to read
+		sel.set_index(match_count, idx);
+		match_count += match;
+		if (NO_MATCH_SEL) {
+			no_match_sel->set_index(no_match_count, idx);
+			no_match_count += 1 - match;
+		}
+	}
+	return match_count;
+}
+
+template <class T, class OP>
+struct BranchlessEqualityMatch {
+	static constexpr const bool VALUE =
+	    std::is_integral<T>::value && (std::is_same<OP, Equals>::value || std::is_same<OP, NotDistinctFrom>::value);
+};
+
 template <bool NO_MATCH_SEL, class T, class OP>
 static idx_t TemplatedMatch(Vector &, const TupleDataVectorFormat &lhs_format, SelectionVector &sel, const idx_t count,
                             const TupleDataLayout &rhs_layout, Vector &rhs_row_locations, const idx_t col_idx,
                             const vector<MatchFunction> &, SelectionVector *no_match_sel, idx_t &no_match_count) {
-	if (lhs_format.unified.validity.AllValid()) {
+	if (BranchlessEqualityMatch<T, OP>::VALUE && lhs_format.unified.validity.AllValid()) {
+		return BranchlessEqualityMatchLoop<NO_MATCH_SEL, T>(lhs_format, sel, count, rhs_layout, rhs_row_locations,
+		                                                    col_idx, no_match_sel, no_match_count);
+	} else if (lhs_format.unified.validity.AllValid()) {
 		return TemplatedMatchLoop<NO_MATCH_SEL, T, OP, true>(lhs_format, sel, count, rhs_layout, rhs_row_locations,
 		                                                     col_idx, no_match_sel, no_match_count);
 	} else {
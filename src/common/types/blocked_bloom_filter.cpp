@@ -0,0 +1,82 @@
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+
+namespace duckdb {
+
+BlockedBloomFilter::BlockedBloomFilter(idx_t expected_count) {
+	const auto block_count = RequiredBlockCount(expected_count);
+	blocks.resize(block_count, 0);
+	bitmask = block_count - 1;
+}
+
+BlockedBloomFilter::BlockedBloomFilter(vector<uint64_t> blocks_p) : blocks(std::move(blocks_p)) {
+	D_ASSERT(!blocks.empty() && IsPowerOfTwo(blocks.size()));
+	bitmask = blocks.size() - 1;
+}
+
+void BlockedBloomFilter::Insert(Vector &hashes, const SelectionVector &sel, idx_t count) {
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	const auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		Insert(hash_data[hdata.sel->get_index(sel.get_index(i))]);
+	}
+}
+
+void BlockedBloomFilter::Insert(Vector &hashes, idx_t count) {
+	Insert(hashes, *FlatVector::IncrementalSelectionVector(), count);
+}
+
+void BlockedBloomFilter::InsertParallel(const hash_t hashes[], idx_t count) {
+	// other threads might set bits in the same block, so we have to use an atomic OR
+	auto atomic_blocks = reinterpret_cast<atomic<uint64_t> *>(blocks.data());
+	for (idx_t i = 0; i < count; i++) {
+		atomic_blocks[GetBlockIndex(hashes[i])].fetch_or(GetBlockMask(hashes[i]), std::memory_order_relaxed);
+	}
+}
+
+void BlockedBloomFilter::Merge(const BlockedBloomFilter &other) {
+	D_ASSERT(blocks.size() == other.blocks.size());
+	for (idx_t block_idx = 0; block_idx < blocks.size(); block_idx++) {
+		blocks[block_idx] |= other.blocks[block_idx];
+	}
+}
+
+idx_t BlockedBloomFilter::Lookup(Vector &hashes, const SelectionVector &sel, idx_t count,
+                                 SelectionVector &result) const {
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	const auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	const auto block_data = blocks.data();
+
+	// branchless probe: always write the index, but only advance the result count if all bits are set
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = sel.get_index(i);
+		const auto hash = hash_data[hdata.sel->get_index(idx)];
+		const auto mask = GetBlockMask(hash);
+		result.set_index(result_count, idx);
+		result_count += (block_data[GetBlockIndex(hash)] & mask) == mask;
+	}
+	return result_count;
+}
+
+void BlockedBloomFilter::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty<idx_t>(100, "block_count", blocks.size());
+	serializer.WriteProperty(101, "data", const_data_ptr_cast(blocks.data()), SizeInBytes());
+}
+
+shared_ptr<BlockedBloomFilter> BlockedBloomFilter::Deserialize(Deserializer &deserializer) {
+	auto block_count = deserializer.ReadProperty<idx_t>(100, "block_count");
+	if (block_count == 0 || !IsPowerOfTwo(block_count)) {
+		throw SerializationException("Invalid block count for BlockedBloomFilter");
+	}
+	vector<uint64_t> blocks(block_count, 0);
+	deserializer.ReadProperty(101, "data", data_ptr_cast(blocks.data()), block_count * sizeof(uint64_t));
+	return make_shared_ptr<BlockedBloomFilter>(std::move(blocks));
+}
+
+} // namespace duckdb
@@ -24,10 +24,106 @@ static inline hash_t CombineHashScalar(hash_t a, hash_t b) {
 	return (a * UINT64_C(0xbf58476d1ce4e5b9)) ^ b;
 }
 
+//===--------------------------------------------------------------------===//
+// Flat Kernels
+//===--------------------------------------------------------------------===//
+// Kernels for flat, all-valid input without selection vectors. These are branch-free loops over contiguous data
+// that are auto-vectorized. For fixed-width integers the kernels are compiled for multiple instruction sets, and the
+// version that matches the CPU is selected at load time.
+
+//! Hash a value in a flat kernel. The exported 64-bit Hash specializations are defined out-of-line, which prevents the
+//! loops from being vectorized, so the kernels call MurmurHash64 directly for these types.
+template <class T>
+static inline hash_t FlatKernelHash(T value) {
+	return duckdb::Hash<T>(value);
+}
+
+template <>
+inline hash_t FlatKernelHash(uint64_t value) {
+	return MurmurHash64(value);
+}
+
+template <>
+inline hash_t FlatKernelHash(int64_t value) {
+	return MurmurHash64(static_cast<uint64_t>(value));
+}
+
+template <class T>
+static inline void HashFlatLoop(const T *__restrict ldata, hash_t *__restrict result_data, idx_t count) {
+	for (idx_t i = 0; i < count; i++) {
+		result_data[i] = FlatKernelHash<T>(ldata[i]);
+	}
+}
+
+template <class T>
+static inline void CombineHashFlatLoop(const T *__restrict ldata, hash_t *__restrict hash_data, idx_t count) {
+	for (idx_t i = 0; i < count; i++) {
+		hash_data[i] = CombineHashScalar(hash_data[i], FlatKernelHash<T>(ldata[i]));
+	}
+}
+
+template <class T>
+static inline void CombineHashConstantFlatLoop(const T *__restrict ldata, hash_t constant_hash,
+                                               hash_t *__restrict hash_data, idx_t count) {
+	for (idx_t i = 0; i < count; i++) {
+		hash_data[i] = CombineHashScalar(constant_hash, FlatKernelHash<T>(ldata[i]));
+	}
+}
+
+template <class T>
+struct HashFlatKernel {
+	static void Hash(const T *ldata, hash_t *result_data, idx_t count) {
+		HashFlatLoop<T>(ldata, result_data, count);
+	}
+	static void CombineHash(const T *ldata, hash_t *hash_data, idx_t count) {
+		CombineHashFlatLoop<T>(ldata, hash_data, count);
+	}
+	static void CombineHashConstant(const T *ldata, hash_t constant_hash, hash_t *hash_data, idx_t count) {
+		CombineHashConstantFlatLoop<T>(ldata, constant_hash, hash_data, count);
+	}
+};
+
+#define DUCKDB_HASH_FLAT_KERNEL(TYPE, NAME)                                                                           \
+	DUCKDB_TARGET_CLONES static void Hash##NAME(const TYPE *ldata, hash_t *result_data, idx_t count) {               \
+		HashFlatLoop<TYPE>(ldata, result_data, count);                                                                \
+	}                                                                                                                 \
+	DUCKDB_TARGET_CLONES static void CombineHash##NAME(const TYPE *ldata, hash_t *hash_data, idx_t count) {          \
+		CombineHashFlatLoop<TYPE>(ldata, hash_data, count);                                                           \
+	}                                                                                                                 \
+	DUCKDB_TARGET_CLONES static void CombineHashConstant##NAME(const TYPE *ldata, hash_t constant_hash,              \
+	                                                           hash_t *hash_data, idx_t count) {                      \
+		CombineHashConstantFlatLoop<TYPE>(ldata, constant_hash, hash_data, count);                                    \
+	}                                                                                                                 \
+	template <>                                                                                                       \
+	struct HashFlatKernel<TYPE> {                                                                                     \
+		static void Hash(const TYPE *ldata, hash_t *result_data, idx_t count) {                                       \
+			Hash##NAME(ldata, result_data, count);                                                                    \
+		}                                                                                                             \
+		static void CombineHash(const TYPE *ldata, hash_t *hash_data, idx_t count) {                                  \
+			CombineHash##NAME(ldata, hash_data, count);                                                               \
+		}                                                                                                             \
+		static void CombineHashConstant(const TYPE *ldata, hash_t constant_hash, hash_t *hash_data, idx_t count) {    \
+			CombineHashConstant##NAME(ldata, constant_hash, hash_data, count);                                        \
+		}                                                                                                             \
+	};
+
+DUCKDB_HASH_FLAT_KERNEL(int8_t, Int8)
+DUCKDB_HASH_FLAT_KERNEL(int16_t, Int16)
+DUCKDB_HASH_FLAT_KERNEL(int32_t, Int32)
+DUCKDB_HASH_FLAT_KERNEL(int64_t, Int64)
+DUCKDB_HASH_FLAT_KERNEL(uint8_t, UInt8)
+DUCKDB_HASH_FLAT_KERNEL(uint16_t, UInt16)
+DUCKDB_HASH_FLAT_KERNEL(uint32_t, UInt32)
+DUCKDB_HASH_FLAT_KERNEL(uint64_t, UInt64)
+
+#undef DUCKDB_HASH_FLAT_KERNEL
+
 template <bool HAS_RSEL, class T>
 static inline void TightLoopHash(const T *__restrict ldata, hash_t *__restrict result_data, const SelectionVector *rsel,
                                  idx_t count, const SelectionVector *__restrict sel_vector, ValidityMask &mask) {
-	if (!mask.AllValid()) {
+	if (!HAS_RSEL && !sel_vector->IsSet() && mask.AllValid()) {
+		HashFlatKernel<T>::Hash(ldata, result_data, count);
+	} else if (!mask.AllValid()) {
 		for (idx_t i = 0; i < count; i++) {
 			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
 			auto idx = sel_vector->get_index(ridx);
@@ -325,7 +421,9 @@ template <bool HAS_RSEL, class T>
 static inline void TightLoopCombineHashConstant(const T *__restrict ldata, hash_t constant_hash,
                                                 hash_t *__restrict hash_data, const SelectionVector *rsel, idx_t count,
                                                 const SelectionVector *__restrict sel_vector, ValidityMask &mask) {
-	if (!mask.AllValid()) {
+	if (!HAS_RSEL && !sel_vector->IsSet() && mask.AllValid()) {
+		HashFlatKernel<T>::CombineHashConstant(ldata, constant_hash, hash_data, count);
+	} else if (!mask.AllValid()) {
 		for (idx_t i = 0; i < count; i++) {
 			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
 			auto idx = sel_vector->get_index(ridx);
@@ -346,7 +444,9 @@ template <bool HAS_RSEL, class T>
 static inline void TightLoopCombineHash(const T *__restrict ldata, hash_t *__restrict hash_data,
                                         const SelectionVector *rsel, idx_t count,
                                         const SelectionVector *__restrict sel_vector, ValidityMask &mask) {
-	if (!mask.AllValid()) {
+	if (!HAS_RSEL && !sel_vector->IsSet() && mask.AllValid()) {
+		HashFlatKernel<T>::CombineHash(ldata, hash_data, count);
+	} else if (!mask.AllValid()) {
 		for (idx_t i = 0; i < count; i++) {
 			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
 			auto idx = sel_vector->get_index(ridx);
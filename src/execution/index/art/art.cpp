@@ -13,10 +13,6 @@
 #include "duckdb/execution/index/art/node256_leaf.hpp"
 #include "duckdb/execution/index/art/node48.hpp"
 #include "duckdb/execution/index/art/prefix.hpp"
-#include "duckdb/optimizer/matcher/expression_matcher.hpp"
-#include "duckdb/planner/expression/bound_between_expression.hpp"
-#include "duckdb/planner/expression/bound_comparison_expression.hpp"
-#include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/storage/arena_allocator.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -112,111 +108,12 @@ ART::ART(const string &name, const IndexConstraintType index_constraint_type, co
 // Initialize Scans
 //===--------------------------------------------------------------------===//
 
-static unique_ptr<IndexScanState> InitializeScanSinglePredicate(const Value &value,
-                                                                const ExpressionType expression_type) {
-	auto result = make_uniq<ARTIndexScanState>();
-	result->values[0] = value;
-	result->expressions[0] = expression_type;
-	return std::move(result);
-}
-
-static unique_ptr<IndexScanState> InitializeScanTwoPredicates(const Value &low_value,
-                                                              const ExpressionType low_expression_type,
-                                                              const Value &high_value,
-                                                              const ExpressionType high_expression_type) {
-	auto result = make_uniq<ARTIndexScanState>();
-	result->values[0] = low_value;
-	result->expressions[0] = low_expression_type;
-	result->values[1] = high_value;
-	result->expressions[1] = high_expression_type;
-	return std::move(result);
-}
-
 unique_ptr<IndexScanState> ART::TryInitializeScan(const Expression &expr, const Expression &filter_expr) {
-	Value low_value, high_value, equal_value;
-	ExpressionType low_comparison_type = ExpressionType::INVALID, high_comparison_type = ExpressionType::INVALID;
-
-	// Try to find a matching index for any of the filter expressions.
-	ComparisonExpressionMatcher matcher;
-	// Match on a comparison type.
-	matcher.expr_type = make_uniq<ComparisonExpressionTypeMatcher>();
-	// Match on a constant comparison with the indexed expression.
-	matcher.matchers.push_back(make_uniq<ExpressionEqualityMatcher>(expr));
-	matcher.matchers.push_back(make_uniq<ConstantExpressionMatcher>());
-	matcher.policy = SetMatcher::Policy::UNORDERED;
-
-	vector<reference<Expression>> bindings;
-	auto filter_match =
-	    matcher.Match(const_cast<Expression &>(filter_expr), bindings); // NOLINT: Match does not alter the expr.
-	if (filter_match) {
-		// This is a range or equality comparison with a constant value, so we can use the index.
-		// 		bindings[0] = the expression
-		// 		bindings[1] = the index expression
-		// 		bindings[2] = the constant
-		auto &comparison = bindings[0].get().Cast<BoundComparisonExpression>();
-		auto constant_value = bindings[2].get().Cast<BoundConstantExpression>().value;
-		auto comparison_type = comparison.type;
-
-		if (comparison.left->type == ExpressionType::VALUE_CONSTANT) {
-			// The expression is on the right side, we flip the comparison expression.
-			comparison_type = FlipComparisonExpression(comparison_type);
-		}
-
-		if (comparison_type == ExpressionType::COMPARE_EQUAL) {
-			// An equality value overrides any other bounds.
-			equal_value = constant_value;
-		} else if (comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
-		           comparison_type == ExpressionType::COMPARE_GREATERTHAN) {
-			// This is a lower bound.
-			low_value = constant_value;
-			low_comparison_type = comparison_type;
-		} else {
-			// This is an upper bound.
-			high_value = constant_value;
-			high_comparison_type = comparison_type;
-		}
-
-	} else if (filter_expr.type == ExpressionType::COMPARE_BETWEEN) {
-		auto &between = filter_expr.Cast<BoundBetweenExpression>();
-		if (!between.input->Equals(expr)) {
-			// The expression does not match the index expression.
-			return nullptr;
-		}
-
-		if (between.lower->type != ExpressionType::VALUE_CONSTANT ||
-		    between.upper->type != ExpressionType::VALUE_CONSTANT) {
-			// Not a constant expression.
-			return nullptr;
-		}
-
-		low_value = between.lower->Cast<BoundConstantExpression>().value;
-		low_comparison_type = between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
-		                                              : ExpressionType::COMPARE_GREATERTHAN;
-		high_value = (between.upper->Cast<BoundConstantExpression>()).value;
-		high_comparison_type =
-		    between.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO : ExpressionType::COMPARE_LESSTHAN;
-	}
-
-	// We cannot use an index scan.
-	if (equal_value.IsNull() && low_value.IsNull() && high_value.IsNull()) {
+	auto result = make_uniq<ARTIndexScanState>();
+	if (!TryGetScanPredicates(expr, filter_expr, result->values, result->expressions)) {
 		return nullptr;
 	}
-
-	// Initialize the index scan state and return it.
-	if (!equal_value.IsNull()) {
-		// Equality predicate.
-		return InitializeScanSinglePredicate(equal_value, ExpressionType::COMPARE_EQUAL);
-	}
-	if (!low_value.IsNull() && !high_value.IsNull()) {
-		// Two-sided predicate.
-		return InitializeScanTwoPredicates(low_value, low_comparison_type, high_value, high_comparison_type);
-	}
-	if (!low_value.IsNull()) {
-		// Less-than predicate.
-		return InitializeScanSinglePredicate(low_value, low_comparison_type);
-	}
-	// Greater-than predicate.
-	return InitializeScanSinglePredicate(high_value, high_comparison_type);
+	return std::move(result);
 }
 
 //===--------------------------------------------------------------------===//
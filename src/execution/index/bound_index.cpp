@@ -2,10 +2,15 @@
 
 #include "duckdb/common/radix.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/optimizer/matcher/expression_matcher.hpp"
+#include "duckdb/planner/expression/bound_between_expression.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
 
 namespace duckdb {
 
@@ -32,6 +37,105 @@ void BoundIndex::InitializeLock(IndexLock &state) {
 	state.index_lock = unique_lock<mutex>(lock);
 }
 
+unique_ptr<IndexScanState> BoundIndex::TryInitializeScan(const Expression &expr, const Expression &filter_expr) {
+	return nullptr;
+}
+
+bool BoundIndex::TryGetScanPredicates(const Expression &expr, const Expression &filter_expr, Value (&values)[2],
+                                      ExpressionType (&expressions)[2]) {
+	Value low_value, high_value, equal_value;
+	ExpressionType low_comparison_type = ExpressionType::INVALID, high_comparison_type = ExpressionType::INVALID;
+
+	// Try to find a matching index for any of the filter expressions.
+	ComparisonExpressionMatcher matcher;
+	// Match on a comparison type.
+	matcher.expr_type = make_uniq<ComparisonExpressionTypeMatcher>();
+	// Match on a constant comparison with the indexed expression.
+	matcher.matchers.push_back(make_uniq<ExpressionEqualityMatcher>(expr));
+	matcher.matchers.push_back(make_uniq<ConstantExpressionMatcher>());
+	matcher.policy = SetMatcher::Policy::UNORDERED;
+
+	vector<reference<Expression>> bindings;
+	auto filter_match =
+	    matcher.Match(const_cast<Expression &>(filter_expr), bindings); // NOLINT: Match does not alter the expr.
+	if (filter_match) {
+		// This is a range or equality comparison with a constant value, so we can use the index.
+		// 		bindings[0] = the expression
+		// 		bindings[1] = the index expression
+		// 		bindings[2] = the constant
+		auto &comparison = bindings[0].get().Cast<BoundComparisonExpression>();
+		auto constant_value = bindings[2].get().Cast<BoundConstantExpression>().value;
+		auto comparison_type = comparison.type;
+
+		if (comparison.left->type == ExpressionType::VALUE_CONSTANT) {
+			// The expression is on the right side, we flip the comparison expression.
+			comparison_type = FlipComparisonExpression(comparison_type);
+		}
+
+		if (comparison_type == ExpressionType::COMPARE_EQUAL) {
+			// An equality value overrides any other bounds.
+			equal_value = constant_value;
+		} else if (comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
+		           comparison_type == ExpressionType::COMPARE_GREATERTHAN) {
+			// This is a lower bound.
+			low_value = constant_value;
+			low_comparison_type = comparison_type;
+		} else {
+			// This is an upper bound.
+			high_value = constant_value;
+			high_comparison_type = comparison_type;
+		}
+
+	} else if (filter_expr.type == ExpressionType::COMPARE_BETWEEN) {
+		auto &between = filter_expr.Cast<BoundBetweenExpression>();
+		if (!between.input->Equals(expr)) {
+			// The expression does not match the index expression.
+			return false;
+		}
+
+		if (between.lower->type != ExpressionType::VALUE_CONSTANT ||
+		    between.upper->type != ExpressionType::VALUE_CONSTANT) {
+			// Not a constant expression.
+			return false;
+		}
+
+		low_value = between.lower->Cast<BoundConstantExpression>().value;
+		low_comparison_type = between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
+		                                              : ExpressionType::COMPARE_GREATERTHAN;
+		high_value = (between.upper->Cast<BoundConstantExpression>()).value;
+		high_comparison_type =
+		    between.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO : ExpressionType::COMPARE_LESSTHAN;
+	}
+
+	// We cannot use an index scan.
+	if (equal_value.IsNull() && low_value.IsNull() && high_value.IsNull()) {
+		return false;
+	}
+
+	if (!equal_value.IsNull()) {
+		// Equality predicate.
+		values[0] = equal_value;
+		expressions[0] = ExpressionType::COMPARE_EQUAL;
+		return true;
+	}
+	idx_t predicate_idx = 0;
+	if (!low_value.IsNull()) {
+		// Greater-than predicate, or the lower bound of a two-sided predicate.
+		values[predicate_idx] = low_value;
+		expressions[predicate_idx++] = low_comparison_type;
+	}
+	if (!high_value.IsNull()) {
+		// Less-than predicate, or the upper bound of a two-sided predicate.
+		values[predicate_idx] = high_value;
+		expressions[predicate_idx] = high_comparison_type;
+	}
+	return true;
+}
+
+bool BoundIndex::Scan(IndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids) {
+	throw NotImplementedException("The index type \"%s\" does not support index scans.", index_type);
+}
+
 ErrorData BoundIndex::Append(DataChunk &entries, Vector &row_identifiers) {
 	IndexLock state;
 	InitializeLock(state);
@@ -0,0 +1,812 @@
+#include "duckdb/execution/index/btree/btree.hpp"
+
+#include "duckdb/common/radix.hpp"
+#include "duckdb/common/types/conflict_manager.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/art/art_key.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+
+#include <queue>
+
+namespace duckdb {
+
+//! The header of a node. In a leaf, the header is followed by the entries. In an inner node, the header is followed
+//! by the child pointers (inner_capacity + 1 slots) and the separators. All entries in the subtree of a child are
+//! smaller than the separator to its right, and greater than or equal to the separator to its left.
+struct BTreeNode {
+	//! The number of entries of a leaf, or the number of separators of an inner node.
+	uint32_t count;
+	//! The neighbouring leaves in key order.
+	IndexPointer prev;
+	IndexPointer next;
+};
+
+//! The node type is stored in the metadata of its pointer.
+enum class BTreeNodeType : uint8_t { LEAF = 1, INNER = 2 };
+
+struct BTreeIndexScanState : public IndexScanState {
+	//! The predicates to scan.
+	//! A single predicate for point lookups, and two predicates for range scans.
+	Value values[2];
+	//! The expressions over the scan predicates.
+	ExpressionType expressions[2];
+};
+
+static inline bool IsLeaf(const IndexPointer ptr) {
+	return ptr.GetMetadata() == static_cast<uint8_t>(BTreeNodeType::LEAF);
+}
+
+//! Returns the position of the first element that is greater than or equal to the key (inclusive), or greater than
+//! the key (exclusive). Only the first compare_size bytes of the elements are compared.
+static idx_t FindPosition(const_data_ptr_t data, const idx_t count, const idx_t size, const_data_ptr_t key,
+                          const idx_t compare_size, const bool inclusive) {
+	idx_t lower = 0;
+	idx_t upper = count;
+	while (lower < upper) {
+		auto middle = lower + (upper - lower) / 2;
+		auto cmp = memcmp(data + middle * size, key, compare_size);
+		if (cmp < 0 || (cmp == 0 && !inclusive)) {
+			lower = middle + 1;
+		} else {
+			upper = middle;
+		}
+	}
+	return lower;
+}
+
+static void InsertAt(data_ptr_t data, const idx_t count, const idx_t pos, const_data_ptr_t element, const idx_t size) {
+	memmove(data + (pos + 1) * size, data + pos * size, (count - pos) * size);
+	memcpy(data + pos * size, element, size);
+}
+
+static void RemoveAt(data_ptr_t data, const idx_t count, const idx_t pos, const idx_t size) {
+	memmove(data + pos * size, data + (pos + 1) * size, (count - pos - 1) * size);
+}
+
+//===--------------------------------------------------------------------===//
+// BTree
+//===--------------------------------------------------------------------===//
+
+BTree::BTree(const string &name, const IndexConstraintType index_constraint_type, const vector<column_t> &column_ids,
+             TableIOManager &table_io_manager, const vector<unique_ptr<Expression>> &unbound_expressions,
+             AttachedDatabase &db, const IndexStorageInfo &info)
+    : BoundIndex(name, BTree::TYPE_NAME, index_constraint_type, column_ids, table_io_manager, unbound_expressions,
+                 db),
+      key_size(0) {
+
+	if (index_constraint_type != IndexConstraintType::NONE) {
+		throw NotImplementedException("BTREE indexes do not support constraints, use an ART index instead");
+	}
+
+	// The entries have a fixed size, so we only support fixed-size keys.
+	for (idx_t i = 0; i < types.size(); i++) {
+		switch (types[i]) {
+		case PhysicalType::BOOL:
+		case PhysicalType::INT8:
+		case PhysicalType::INT16:
+		case PhysicalType::INT32:
+		case PhysicalType::INT64:
+		case PhysicalType::INT128:
+		case PhysicalType::UINT8:
+		case PhysicalType::UINT16:
+		case PhysicalType::UINT32:
+		case PhysicalType::UINT64:
+		case PhysicalType::UINT128:
+		case PhysicalType::FLOAT:
+		case PhysicalType::DOUBLE:
+			break;
+		default:
+			throw InvalidTypeException(logical_types[i], "Invalid type for BTREE index key.");
+		}
+		key_size += GetTypeIdSize(types[i]);
+	}
+
+	entry_size = key_size + sizeof(row_t);
+	leaf_capacity = (NODE_SIZE - sizeof(BTreeNode)) / entry_size;
+	inner_capacity = (NODE_SIZE - sizeof(BTreeNode) - sizeof(IndexPointer)) / (entry_size + sizeof(IndexPointer));
+	if (inner_capacity < MIN_NODE_CAPACITY) {
+		throw NotImplementedException("The key of BTREE index \"%s\" exceeds the maximum key size", name);
+	}
+	separator_buffer.resize(2 * entry_size);
+
+	allocator = make_uniq<FixedSizeAllocator>(NODE_SIZE, table_io_manager.GetIndexBlockManager());
+	if (!info.IsValid()) {
+		// We create a new B+-tree.
+		return;
+	}
+
+	// Set the root node and initialize the allocator.
+	root.Set(info.root);
+	allocator->Init(info.allocator_infos[0]);
+}
+
+//===--------------------------------------------------------------------===//
+// Nodes
+//===--------------------------------------------------------------------===//
+
+IndexPointer BTree::NewNode(const bool leaf) {
+	auto ptr = allocator->New();
+	ptr.SetMetadata(static_cast<uint8_t>(leaf ? BTreeNodeType::LEAF : BTreeNodeType::INNER));
+	auto &node = GetNode(ptr);
+	node.count = 0;
+	node.prev.Clear();
+	node.next.Clear();
+	return ptr;
+}
+
+BTreeNode &BTree::GetNode(const IndexPointer ptr, const bool dirty) {
+	D_ASSERT(ptr.HasMetadata());
+	return *allocator->Get<BTreeNode>(ptr, dirty);
+}
+
+data_ptr_t BTree::GetEntries(BTreeNode &node) {
+	return data_ptr_cast(&node) + sizeof(BTreeNode);
+}
+
+IndexPointer *BTree::GetChildren(BTreeNode &node) {
+	return reinterpret_cast<IndexPointer *>(GetEntries(node));
+}
+
+data_ptr_t BTree::GetSeparators(BTreeNode &node) {
+	return GetEntries(node) + (inner_capacity + 1) * sizeof(IndexPointer);
+}
+
+IndexPointer BTree::GetFirstLeaf() {
+	auto ptr = root;
+	while (ptr.HasMetadata() && !IsLeaf(ptr)) {
+		ptr = GetChildren(GetNode(ptr, false))[0];
+	}
+	return ptr;
+}
+
+void BTree::FindLeaf(const_data_ptr_t entry) {
+	D_ASSERT(root.HasMetadata());
+	path.clear();
+	auto ptr = root;
+	while (!IsLeaf(ptr)) {
+		auto &node = GetNode(ptr, false);
+		auto child_idx = FindPosition(GetSeparators(node), node.count, entry_size, entry, entry_size, false);
+		path.emplace_back(ptr, child_idx);
+		ptr = GetChildren(node)[child_idx];
+	}
+	path.emplace_back(ptr, 0);
+}
+
+//! Iterates over the entries of a B+-tree in order.
+class BTreeCursor {
+public:
+	explicit BTreeCursor(BTree &tree) : tree(tree), leaf(tree.GetFirstLeaf()), pos(0) {
+		SkipEmptyLeaves();
+	}
+
+	bool Valid() const {
+		return leaf.HasMetadata();
+	}
+	const_data_ptr_t Get() {
+		return tree.GetEntries(tree.GetNode(leaf, false)) + pos * tree.entry_size;
+	}
+	void Next() {
+		pos++;
+		SkipEmptyLeaves();
+	}
+
+private:
+	BTree &tree;
+	IndexPointer leaf;
+	idx_t pos;
+
+private:
+	void SkipEmptyLeaves() {
+		while (leaf.HasMetadata()) {
+			auto &node = tree.GetNode(leaf, false);
+			if (pos < node.count) {
+				return;
+			}
+			leaf = node.next;
+			pos = 0;
+		}
+	}
+};
+
+//! Builds a B+-tree bottom-up from entries that are appended in sorted order.
+class BTreeBuilder {
+public:
+	explicit BTreeBuilder(BTree &tree) : tree(tree) {
+	}
+
+	void Append(const_data_ptr_t entry) {
+		if (nodes.empty()) {
+			nodes.push_back(tree.NewNode(true));
+		}
+		auto &leaf = tree.GetNode(nodes[0]);
+		if (leaf.count < tree.leaf_capacity) {
+			memcpy(tree.GetEntries(leaf) + leaf.count * tree.entry_size, entry, tree.entry_size);
+			leaf.count++;
+			return;
+		}
+
+		// The leaf is full: start a new leaf, and add its first entry as a separator to the level above.
+		auto new_leaf_ptr = tree.NewNode(true);
+		auto &new_leaf = tree.GetNode(new_leaf_ptr);
+		memcpy(tree.GetEntries(new_leaf), entry, tree.entry_size);
+		new_leaf.count = 1;
+		new_leaf.prev = nodes[0];
+		leaf.next = new_leaf_ptr;
+		AppendChild(1, entry, new_leaf_ptr);
+		nodes[0] = new_leaf_ptr;
+	}
+
+	void Finalize() {
+		D_ASSERT(!tree.root.HasMetadata());
+		if (!nodes.empty()) {
+			tree.root = nodes.back();
+		}
+	}
+
+private:
+	BTree &tree;
+	//! The rightmost node of each level, starting at the leaves.
+	unsafe_vector<IndexPointer> nodes;
+
+private:
+	void AppendChild(const idx_t level, const_data_ptr_t separator, const IndexPointer child) {
+		if (level == nodes.size()) {
+			// Add a new level above the current root.
+			auto node_ptr = tree.NewNode(false);
+			tree.GetChildren(tree.GetNode(node_ptr))[0] = nodes[level - 1];
+			nodes.push_back(node_ptr);
+		}
+
+		auto &node = tree.GetNode(nodes[level]);
+		if (node.count < tree.inner_capacity) {
+			memcpy(tree.GetSeparators(node) + node.count * tree.entry_size, separator, tree.entry_size);
+			tree.GetChildren(node)[node.count + 1] = child;
+			node.count++;
+			return;
+		}
+
+		// The node is full: start a new node, and move the separator to the level above.
+		auto new_node_ptr = tree.NewNode(false);
+		tree.GetChildren(tree.GetNode(new_node_ptr))[0] = child;
+		AppendChild(level + 1, separator, new_node_ptr);
+		nodes[level] = new_node_ptr;
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Initialize Scans
+//===--------------------------------------------------------------------===//
+
+unique_ptr<IndexScanState> BTree::TryInitializeScan(const Expression &expr, const Expression &filter_expr) {
+	auto result = make_uniq<BTreeIndexScanState>();
+	if (!TryGetScanPredicates(expr, filter_expr, result->values, result->expressions)) {
+		return nullptr;
+	}
+	return std::move(result);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+
+bool BTree::Scan(IndexScanState &state, const idx_t max_count, unsafe_vector<row_t> &row_ids) {
+	auto &scan_state = state.Cast<BTreeIndexScanState>();
+	D_ASSERT(types.size() == 1);
+	ArenaAllocator arena_allocator(Allocator::Get(db));
+
+	// Get the bounds of the scan. An empty key indicates that no bound exists.
+	ARTKey lower_bound;
+	ARTKey upper_bound;
+	bool lower_inclusive = true;
+	bool upper_inclusive = true;
+	for (idx_t i = 0; i < 2; i++) {
+		auto &value = scan_state.values[i];
+		if (value.IsNull()) {
+			continue;
+		}
+		D_ASSERT(value.type().InternalType() == types[0]);
+		auto key = ARTKey::CreateKey(arena_allocator, types[0], value);
+		D_ASSERT(key.len == key_size);
+		switch (scan_state.expressions[i]) {
+		case ExpressionType::COMPARE_EQUAL:
+			lower_bound = key;
+			upper_bound = key;
+			break;
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		case ExpressionType::COMPARE_GREATERTHAN:
+			lower_bound = key;
+			lower_inclusive = scan_state.expressions[i] == ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+			break;
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		case ExpressionType::COMPARE_LESSTHAN:
+			upper_bound = key;
+			upper_inclusive = scan_state.expressions[i] == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+			break;
+		default:
+			throw InternalException("Index scan type not implemented");
+		}
+	}
+
+	lock_guard<mutex> l(lock);
+
+	// Descend to the first entry satisfying the lower bound.
+	// If the leaf does not contain such an entry, then the scan continues in its right neighbour.
+	auto leaf_ptr = root;
+	idx_t pos = 0;
+	if (lower_bound.Empty()) {
+		leaf_ptr = GetFirstLeaf();
+	} else if (leaf_ptr.HasMetadata()) {
+		while (!IsLeaf(leaf_ptr)) {
+			auto &node = GetNode(leaf_ptr, false);
+			auto child_idx =
+			    FindPosition(GetSeparators(node), node.count, entry_size, lower_bound.data, key_size, lower_inclusive);
+			leaf_ptr = GetChildren(node)[child_idx];
+		}
+		auto &leaf = GetNode(leaf_ptr, false);
+		pos = FindPosition(GetEntries(leaf), leaf.count, entry_size, lower_bound.data, key_size, lower_inclusive);
+	}
+
+	// Scan the leaves until we reach the upper bound.
+	while (leaf_ptr.HasMetadata()) {
+		auto &leaf = GetNode(leaf_ptr, false);
+		auto entries = GetEntries(leaf);
+		for (; pos < leaf.count; pos++) {
+			auto entry = entries + pos * entry_size;
+			if (!upper_bound.Empty()) {
+				auto cmp = memcmp(entry, upper_bound.data, key_size);
+				if (cmp > 0 || (cmp == 0 && !upper_inclusive)) {
+					return true;
+				}
+			}
+			if (row_ids.size() + 1 > max_count) {
+				return false;
+			}
+			row_ids.push_back(Radix::DecodeData<row_t>(entry + key_size));
+		}
+		leaf_ptr = leaf.next;
+		pos = 0;
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Insert
+//===--------------------------------------------------------------------===//
+
+idx_t BTree::GenerateEntries(DataChunk &input, Vector &row_ids, unsafe_vector<data_t> &entries) {
+	auto row_count = input.size();
+	ArenaAllocator arena_allocator(BufferAllocator::Get(db));
+	unsafe_vector<ARTKey> keys(row_count);
+	unsafe_vector<ARTKey> row_id_keys(row_count);
+	ART::GenerateKeyVectors(arena_allocator, input, row_ids, keys, row_id_keys);
+
+	// NULLs are not part of the index.
+	entries.resize(row_count * entry_size);
+	idx_t entry_count = 0;
+	for (idx_t i = 0; i < row_count; i++) {
+		if (keys[i].Empty()) {
+			continue;
+		}
+		D_ASSERT(keys[i].len == key_size && row_id_keys[i].len == sizeof(row_t));
+		auto entry = entries.data() + entry_count * entry_size;
+		memcpy(entry, keys[i].data, key_size);
+		memcpy(entry + key_size, row_id_keys[i].data, sizeof(row_t));
+		entry_count++;
+	}
+	return entry_count;
+}
+
+void BTree::InsertEntry(const_data_ptr_t entry) {
+	if (!root.HasMetadata()) {
+		root = NewNode(true);
+	}
+
+	FindLeaf(entry);
+	auto leaf_ptr = path.back().first;
+	auto &leaf = GetNode(leaf_ptr);
+	auto entries = GetEntries(leaf);
+	auto pos = FindPosition(entries, leaf.count, entry_size, entry, entry_size, true);
+	if (pos < leaf.count && memcmp(entries + pos * entry_size, entry, entry_size) == 0) {
+		// The entry already exists.
+		return;
+	}
+	if (leaf.count < leaf_capacity) {
+		InsertAt(entries, leaf.count, pos, entry, entry_size);
+		leaf.count++;
+		return;
+	}
+
+	// Split the leaf by moving the upper half of its entries into a new right neighbour.
+	auto right_ptr = NewNode(true);
+	auto &right = GetNode(right_ptr);
+	auto left_count = (leaf.count + 1) / 2;
+	right.count = NumericCast<uint32_t>(leaf.count - left_count);
+	memcpy(GetEntries(right), entries + left_count * entry_size, right.count * entry_size);
+	leaf.count = NumericCast<uint32_t>(left_count);
+
+	right.prev = leaf_ptr;
+	right.next = leaf.next;
+	if (leaf.next.HasMetadata()) {
+		GetNode(leaf.next).prev = right_ptr;
+	}
+	leaf.next = right_ptr;
+
+	if (pos <= left_count) {
+		InsertAt(entries, leaf.count, pos, entry, entry_size);
+		leaf.count++;
+	} else {
+		InsertAt(GetEntries(right), right.count, pos - left_count, entry, entry_size);
+		right.count++;
+	}
+
+	auto separator = separator_buffer.data();
+	memcpy(separator, GetEntries(right), entry_size);
+	InsertSeparator(separator, right_ptr);
+}
+
+void BTree::InsertSeparator(data_ptr_t separator, IndexPointer child) {
+	D_ASSERT(!path.empty());
+	path.pop_back();
+
+	while (!path.empty()) {
+		auto node_ptr = path.back().first;
+		auto child_idx = path.back().second;
+		path.pop_back();
+
+		auto &node = GetNode(node_ptr);
+		auto separators = GetSeparators(node);
+		auto children = GetChildren(node);
+		if (node.count < inner_capacity) {
+			InsertAt(separators, node.count, child_idx, separator, entry_size);
+			InsertAt(data_ptr_cast(children), node.count + 1, child_idx + 1, const_data_ptr_cast(&child),
+			         sizeof(IndexPointer));
+			node.count++;
+			return;
+		}
+
+		// Split the inner node: the separator in the middle moves up, and the separators and children to its right
+		// move into a new right neighbour.
+		auto right_ptr = NewNode(false);
+		auto &right = GetNode(right_ptr);
+		idx_t mid = node.count / 2;
+		auto promoted = separator == separator_buffer.data() ? separator_buffer.data() + entry_size
+		                                                     : separator_buffer.data();
+		memcpy(promoted, separators + mid * entry_size, entry_size);
+
+		right.count = NumericCast<uint32_t>(node.count - mid - 1);
+		memcpy(GetSeparators(right), separators + (mid + 1) * entry_size, right.count * entry_size);
+		memcpy(GetChildren(right), children + mid + 1, (right.count + 1) * sizeof(IndexPointer));
+		node.count = NumericCast<uint32_t>(mid);
+
+		if (child_idx <= mid) {
+			InsertAt(separators, node.count, child_idx, separator, entry_size);
+			InsertAt(data_ptr_cast(children), node.count + 1, child_idx + 1, const_data_ptr_cast(&child),
+			         sizeof(IndexPointer));
+			node.count++;
+		} else {
+			auto right_idx = child_idx - mid - 1;
+			InsertAt(GetSeparators(right), right.count, right_idx, separator, entry_size);
+			InsertAt(data_ptr_cast(GetChildren(right)), right.count + 1, right_idx + 1, const_data_ptr_cast(&child),
+			         sizeof(IndexPointer));
+			right.count++;
+		}
+
+		separator = promoted;
+		child = right_ptr;
+	}
+
+	// The root split, so we add a new root.
+	auto new_root = NewNode(false);
+	auto &node = GetNode(new_root);
+	GetChildren(node)[0] = root;
+	GetChildren(node)[1] = child;
+	memcpy(GetSeparators(node), separator, entry_size);
+	node.count = 1;
+	root = new_root;
+}
+
+ErrorData BTree::Insert(IndexLock &lock, DataChunk &input, Vector &row_ids) {
+	D_ASSERT(row_ids.GetType().InternalType() == ROW_TYPE);
+	unsafe_vector<data_t> entries;
+	auto entry_count = GenerateEntries(input, row_ids, entries);
+	for (idx_t i = 0; i < entry_count; i++) {
+		InsertEntry(entries.data() + i * entry_size);
+	}
+	return ErrorData();
+}
+
+ErrorData BTree::Append(IndexLock &lock, DataChunk &input, Vector &row_ids) {
+	// Execute all column expressions before inserting the data chunk.
+	DataChunk expr_chunk;
+	expr_chunk.Initialize(Allocator::DefaultAllocator(), logical_types);
+	ExecuteExpressions(input, expr_chunk);
+	return Insert(lock, expr_chunk, row_ids);
+}
+
+void BTree::VerifyAppend(DataChunk &chunk) {
+}
+
+void BTree::VerifyAppend(DataChunk &chunk, ConflictManager &conflict_manager) {
+}
+
+void BTree::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) {
+}
+
+string BTree::GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index, DataChunk &input) {
+	throw InternalException("BTREE indexes do not have constraints");
+}
+
+//===--------------------------------------------------------------------===//
+// Drop and Delete
+//===--------------------------------------------------------------------===//
+
+void BTree::CommitDrop(IndexLock &index_lock) {
+	allocator->Reset();
+	root.Clear();
+}
+
+void BTree::DeleteEntry(const_data_ptr_t entry) {
+	if (!root.HasMetadata()) {
+		return;
+	}
+
+	FindLeaf(entry);
+	auto &leaf = GetNode(path.back().first, false);
+	auto pos = FindPosition(GetEntries(leaf), leaf.count, entry_size, entry, entry_size, true);
+	if (pos == leaf.count || memcmp(GetEntries(leaf) + pos * entry_size, entry, entry_size) != 0) {
+		// The entry does not exist.
+		return;
+	}
+
+	auto &dirty_leaf = GetNode(path.back().first);
+	RemoveAt(GetEntries(dirty_leaf), dirty_leaf.count, pos, entry_size);
+	dirty_leaf.count--;
+
+	// We do not merge underfull nodes, but we remove empty nodes.
+	if (dirty_leaf.count == 0) {
+		RemoveNode();
+	}
+	CollapseRoot();
+}
+
+void BTree::RemoveNode() {
+	auto node_ptr = path.back().first;
+	path.pop_back();
+
+	if (IsLeaf(node_ptr)) {
+		auto &leaf = GetNode(node_ptr, false);
+		if (leaf.prev.HasMetadata()) {
+			GetNode(leaf.prev).next = leaf.next;
+		}
+		if (leaf.next.HasMetadata()) {
+			GetNode(leaf.next).prev = leaf.prev;
+		}
+	}
+	allocator->Free(node_ptr);
+
+	if (path.empty()) {
+		root.Clear();
+		return;
+	}
+
+	auto parent_ptr = path.back().first;
+	auto child_idx = path.back().second;
+	auto &parent = GetNode(parent_ptr);
+	if (parent.count == 0) {
+		// We removed the only child of the parent.
+		RemoveNode();
+		return;
+	}
+
+	// Remove the child and the separator to its left, or to its right, if it is the leftmost child.
+	RemoveAt(data_ptr_cast(GetChildren(parent)), parent.count + 1, child_idx, sizeof(IndexPointer));
+	RemoveAt(GetSeparators(parent), parent.count, child_idx == 0 ? 0 : child_idx - 1, entry_size);
+	parent.count--;
+}
+
+void BTree::CollapseRoot() {
+	while (root.HasMetadata() && !IsLeaf(root)) {
+		auto &node = GetNode(root, false);
+		if (node.count != 0) {
+			return;
+		}
+		auto child = GetChildren(node)[0];
+		allocator->Free(root);
+		root = child;
+	}
+}
+
+void BTree::Delete(IndexLock &state, DataChunk &input, Vector &row_ids) {
+	DataChunk expr_chunk;
+	expr_chunk.Initialize(Allocator::DefaultAllocator(), logical_types);
+	ExecuteExpressions(input, expr_chunk);
+
+	unsafe_vector<data_t> entries;
+	auto entry_count = GenerateEntries(expr_chunk, row_ids, entries);
+	for (idx_t i = 0; i < entry_count; i++) {
+		DeleteEntry(entries.data() + i * entry_size);
+	}
+
+	if (!root.HasMetadata()) {
+		// No more allocations.
+		VerifyAllocationsInternal();
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Merging and Vacuum
+//===--------------------------------------------------------------------===//
+
+void BTree::Rebuild(const vector<reference<BTree>> &others) {
+	BTree result(name, index_constraint_type, column_ids, table_io_manager, unbound_expressions, db);
+	BTreeBuilder builder(result);
+
+	// Merge the entries of all trees in order, using a min-heap on the next entry of each tree.
+	vector<unique_ptr<BTreeCursor>> cursors;
+	cursors.push_back(make_uniq<BTreeCursor>(*this));
+	for (auto &other : others) {
+		cursors.push_back(make_uniq<BTreeCursor>(other.get()));
+	}
+	auto greater = [&](const idx_t lhs, const idx_t rhs) {
+		return memcmp(cursors[lhs]->Get(), cursors[rhs]->Get(), entry_size) > 0;
+	};
+	std::priority_queue<idx_t, vector<idx_t>, decltype(greater)> heap(greater);
+	for (idx_t i = 0; i < cursors.size(); i++) {
+		if (cursors[i]->Valid()) {
+			heap.push(i);
+		}
+	}
+	while (!heap.empty()) {
+		auto cursor_idx = heap.top();
+		heap.pop();
+		auto &cursor = *cursors[cursor_idx];
+		builder.Append(cursor.Get());
+		cursor.Next();
+		if (cursor.Valid()) {
+			heap.push(cursor_idx);
+		}
+	}
+	builder.Finalize();
+
+	// Replace the nodes of this tree, and free the old nodes.
+	std::swap(allocator, result.allocator);
+	std::swap(root, result.root);
+	result.allocator->Reset();
+	result.root.Clear();
+	for (auto &other : others) {
+		other.get().allocator->Reset();
+		other.get().root.Clear();
+	}
+}
+
+bool BTree::MergeIndexes(IndexLock &state, BoundIndex &other_index) {
+	vector<reference<BTree>> others;
+	others.push_back(other_index.Cast<BTree>());
+	MergeIndexes(state, others);
+	return true;
+}
+
+void BTree::MergeIndexes(IndexLock &state, const vector<reference<BTree>> &other_indexes) {
+	vector<reference<BTree>> others;
+	for (auto &other : other_indexes) {
+		if (other.get().root.HasMetadata()) {
+			others.push_back(other);
+		}
+	}
+	if (others.empty()) {
+		return;
+	}
+
+	if (!root.HasMetadata() && others.size() == 1) {
+		// Take over the nodes of the other tree.
+		auto &other = others[0].get();
+		std::swap(allocator, other.allocator);
+		root = other.root;
+		other.root.Clear();
+		return;
+	}
+
+	Rebuild(others);
+}
+
+void BTree::Vacuum(IndexLock &state) {
+	if (!root.HasMetadata()) {
+		allocator->Reset();
+		return;
+	}
+
+	// The nodes are not relocated one by one, as that requires updating the pointers of both their parents and
+	// their neighbouring leaves. Instead, we rebuild the tree, if enough of its buffers qualify for a vacuum.
+	if (!allocator->InitializeVacuum()) {
+		return;
+	}
+	Rebuild(vector<reference<BTree>>());
+}
+
+//===--------------------------------------------------------------------===//
+// Storage and Memory
+//===--------------------------------------------------------------------===//
+
+IndexStorageInfo BTree::GetStorageInfo(const case_insensitive_map_t<Value> &options, const bool to_wal) {
+	IndexStorageInfo info(name);
+	info.root = root.Get();
+	info.options = options;
+	allocator->RemoveEmptyBuffers();
+
+	if (!to_wal) {
+		// Store the data on disk as partial blocks and set the block ids.
+		WritePartialBlocks();
+	} else {
+		// Set the correct allocation sizes and get the map containing all buffers.
+		info.buffers.push_back(allocator->InitSerializationToWAL());
+	}
+	info.allocator_infos.push_back(allocator->GetInfo());
+	return info;
+}
+
+void BTree::WritePartialBlocks() {
+	auto &block_manager = table_io_manager.GetIndexBlockManager();
+	PartialBlockManager partial_block_manager(block_manager, PartialBlockType::FULL_CHECKPOINT);
+	allocator->SerializeBuffers(partial_block_manager);
+	partial_block_manager.FlushPartialBlocks();
+}
+
+idx_t BTree::GetInMemorySize(IndexLock &index_lock) {
+	return allocator->GetInMemorySize();
+}
+
+//===--------------------------------------------------------------------===//
+// Verification
+//===--------------------------------------------------------------------===//
+
+string BTree::VerifyAndToString(IndexLock &state, const bool only_verify) {
+	if (!root.HasMetadata()) {
+		return "[empty]";
+	}
+
+	idx_t entry_count = 0;
+	string row_id_str;
+	const_data_ptr_t previous = nullptr;
+	for (BTreeCursor cursor(*this); cursor.Valid(); cursor.Next()) {
+		auto entry = cursor.Get();
+		if (previous && memcmp(previous, entry, entry_size) >= 0) {
+			throw InternalException("BTREE index \"%s\" is not sorted", name);
+		}
+		if (!only_verify) {
+			row_id_str += entry_count == 0 ? "" : ", ";
+			row_id_str += to_string(Radix::DecodeData<row_t>(entry + key_size));
+		}
+		previous = entry;
+		entry_count++;
+	}
+	return StringUtil::Format("BTree: %llu entries [%s]", entry_count, row_id_str);
+}
+
+idx_t BTree::CountNodes(const IndexPointer ptr) {
+	if (IsLeaf(ptr)) {
+		return 1;
+	}
+	auto &node = GetNode(ptr, false);
+	idx_t node_count = 1;
+	for (idx_t i = 0; i <= node.count; i++) {
+		node_count += CountNodes(GetChildren(node)[i]);
+	}
+	return node_count;
+}
+
+void BTree::VerifyAllocations(IndexLock &state) {
+	return VerifyAllocationsInternal();
+}
+
+void BTree::VerifyAllocationsInternal() {
+#ifdef DEBUG
+	auto node_count = root.HasMetadata() ? CountNodes(root) : 0;
+	D_ASSERT(allocator->GetSegmentCount() == node_count);
+#endif
+}
+
+constexpr const char *BTree::TYPE_NAME;
+
+} // namespace duckdb
@@ -1,5 +1,6 @@
 #include "duckdb/execution/join_hashtable.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
@@ -20,7 +21,9 @@ JoinHashTable::SharedState::SharedState()
 
 JoinHashTable::ProbeState::ProbeState()
     : SharedState(), salt_v(LogicalType::UBIGINT), ht_offsets_v(LogicalType::UBIGINT),
-      ht_offsets_dense_v(LogicalType::UBIGINT), non_empty_sel(STANDARD_VECTOR_SIZE) {
+      ht_offsets_dense_v(LogicalType::UBIGINT), non_empty_sel(STANDARD_VECTOR_SIZE),
+      bloom_filter_sel(STANDARD_VECTOR_SIZE), use_bloom_filter(true), bloom_filter_probe_count(0),
+      bloom_filter_pass_count(0) {
 }
 
 JoinHashTable::InsertState::InsertState(const JoinHashTable &ht)
@@ -293,6 +296,27 @@ inline bool JoinHashTable::UseSalt() const {
 	return this->capacity > USE_SALT_THRESHOLD && this->equality_predicate_columns.size() == 1;
 }
 
+void JoinHashTable::ApplyBloomFilter(ProbeState &state, Vector &hashes_v, const SelectionVector *&current_sel,
+                                     idx_t &count) {
+	if (!bloom_filter || !state.use_bloom_filter) {
+		return;
+	}
+	const auto probe_count = count;
+	count = bloom_filter->Lookup(hashes_v, *current_sel, count, state.bloom_filter_sel);
+	current_sel = &state.bloom_filter_sel;
+
+	// the Bloom filter only pays off if it removes a significant fraction of the keys
+	// if most keys pass it anyway (e.g., a foreign key join), we stop checking it for this probe state
+	if (state.bloom_filter_probe_count < BLOOM_FILTER_SAMPLE_COUNT) {
+		state.bloom_filter_probe_count += probe_count;
+		state.bloom_filter_pass_count += count;
+		if (state.bloom_filter_probe_count >= BLOOM_FILTER_SAMPLE_COUNT &&
+		    state.bloom_filter_pass_count * 100 > state.bloom_filter_probe_count * BLOOM_FILTER_MAX_PASS_PERCENTAGE) {
+			state.use_bloom_filter = false;
+		}
+	}
+}
+
 void JoinHashTable::GetRowPointers(DataChunk &keys, TupleDataChunkState &key_state, ProbeState &state, Vector &hashes_v,
                                    const SelectionVector &sel, idx_t &count, Vector &pointers_result_v,
                                    SelectionVector &match_sel) {
@@ -693,6 +717,13 @@ void JoinHashTable::InitializePointerTable() {
 	std::fill_n(entries, capacity, ht_entry_t::GetEmptyEntry());
 
 	bitmask = capacity - 1;
+
+	// (re-)initialize the Bloom filter, the hashes are inserted during Finalize
+	if (UseBloomFilter(Count())) {
+		bloom_filter = make_uniq<BlockedBloomFilter>(Count());
+	} else {
+		bloom_filter.reset();
+	}
 }
 
 void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel) {
@@ -712,6 +743,10 @@ void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool para
 		for (idx_t i = 0; i < count; i++) {
 			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
 		}
+		if (bloom_filter) {
+			// InsertHashes modifies the hashes, so we have to add them to the Bloom filter first
+			bloom_filter->InsertParallel(hash_data, count);
+		}
 		TupleDataChunkState &chunk_state = iterator.GetChunkState();
 
 		InsertHashes(hashes, count, chunk_state, insert_state, parallel);
@@ -744,6 +779,7 @@ void JoinHashTable::Probe(ScanStructure &scan_structure, DataChunk &keys, TupleD
 	}
 
 	if (precomputed_hashes) {
+		ApplyBloomFilter(probe_state, *precomputed_hashes, current_sel, scan_structure.count);
 		GetRowPointers(keys, key_state, probe_state, *precomputed_hashes, *current_sel, scan_structure.count,
 		               scan_structure.pointers, scan_structure.sel_vector);
 	} else {
@@ -751,6 +787,9 @@ void JoinHashTable::Probe(ScanStructure &scan_structure, DataChunk &keys, TupleD
 		// hash all the keys
 		Hash(keys, *current_sel, scan_structure.count, hashes);
 
+		// skip the keys that are definitely not in the HT
+		ApplyBloomFilter(probe_state, hashes, current_sel, scan_structure.count);
+
 		// now initialize the pointers of the scan structure based on the hashes
 		GetRowPointers(keys, key_state, probe_state, hashes, *current_sel, scan_structure.count,
 		               scan_structure.pointers, scan_structure.sel_vector);
@@ -1365,11 +1404,15 @@ idx_t JoinHashTable::GetRemainingSize() const {
 	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
 	auto &partitions = sink_collection->GetPartitions();
 
+	// The partition order is only initialized once we start building partitions externally
+	D_ASSERT(partition_order.empty() || partition_order.size() == num_partitions);
 	idx_t count = 0;
 	idx_t data_size = 0;
-	for (idx_t partition_idx = partition_end; partition_idx < num_partitions; partition_idx++) {
-		count += partitions[partition_idx]->Count();
-		data_size += partitions[partition_idx]->SizeInBytes();
+	for (idx_t partition_pos = partition_end; partition_pos < num_partitions; partition_pos++) {
+		const auto partition_idx = partition_order.empty() ? partition_pos : partition_order[partition_pos];
+		auto &partition = *partitions[partition_idx];
+		count += partition.Count();
+		data_size += partition.SizeInBytes();
 	}
 
 	return data_size + PointerTableSize(count);
@@ -1379,6 +1422,17 @@ void JoinHashTable::Unpartition() {
 	data_collection = sink_collection->GetUnpartitioned();
 }
 
+void JoinHashTable::SetInitialRadixBits(const idx_t radix_bits_p) {
+	D_ASSERT(radix_bits_p <= RadixPartitioning::MAX_RADIX_BITS);
+	D_ASSERT(sink_collection->Count() == 0);
+	if (radix_bits_p == radix_bits) {
+		return;
+	}
+	radix_bits = radix_bits_p;
+	sink_collection =
+	    make_uniq<RadixPartitionedTupleData>(buffer_manager, layout, radix_bits, layout.ColumnCount() - 1);
+}
+
 void JoinHashTable::SetRepartitionRadixBits(const idx_t max_ht_size, const idx_t max_partition_size,
                                             const idx_t max_partition_count) {
 	D_ASSERT(max_partition_size + PointerTableSize(max_partition_count) > max_ht_size);
@@ -1399,6 +1453,7 @@ void JoinHashTable::SetRepartitionRadixBits(const idx_t max_ht_size, const idx_t
 		}
 	}
 	radix_bits += added_bits;
+	partition_order.clear();
 	sink_collection =
 	    make_uniq<RadixPartitionedTupleData>(buffer_manager, layout, radix_bits, layout.ColumnCount() - 1);
 }
@@ -1423,6 +1478,9 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 	}
 
 	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
+	if (partition_order.empty()) {
+		InitializePartitionOrder();
+	}
 	if (partition_end == num_partitions) {
 		return false;
 	}
@@ -1434,10 +1492,11 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 	// Determine how many partitions we can do next (at least one)
 	idx_t count = 0;
 	idx_t data_size = 0;
-	idx_t partition_idx;
-	for (partition_idx = partition_start; partition_idx < num_partitions; partition_idx++) {
-		auto incl_count = count + partitions[partition_idx]->Count();
-		auto incl_data_size = data_size + partitions[partition_idx]->SizeInBytes();
+	idx_t partition_pos;
+	for (partition_pos = partition_start; partition_pos < num_partitions; partition_pos++) {
+		auto &partition = *partitions[partition_order[partition_pos]];
+		auto incl_count = count + partition.Count();
+		auto incl_data_size = data_size + partition.SizeInBytes();
 		auto incl_ht_size = incl_data_size + PointerTableSize(incl_count);
 		if (count > 0 && incl_ht_size > max_ht_size) {
 			break;
@@ -1445,10 +1504,13 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 		count = incl_count;
 		data_size = incl_data_size;
 	}
-	partition_end = partition_idx;
+	partition_end = partition_pos;
 
 	// Move the partitions to the main data collection
-	for (partition_idx = partition_start; partition_idx < partition_end; partition_idx++) {
+	memset(current_partitions.get(), 0, num_partitions * sizeof(bool));
+	for (partition_pos = partition_start; partition_pos < partition_end; partition_pos++) {
+		const auto partition_idx = partition_order[partition_pos];
+		current_partitions[partition_idx] = true;
 		data_collection->Combine(*partitions[partition_idx]);
 	}
 	D_ASSERT(Count() == count);
@@ -1456,6 +1518,49 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 	return true;
 }
 
+void JoinHashTable::InitializePartitionOrder() {
+	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
+	auto &partitions = sink_collection->GetPartitions();
+	D_ASSERT(partitions.size() == num_partitions);
+
+	// Build the smallest partitions first: we assume that the probe side is distributed evenly over the partitions,
+	// so covering as many partitions as possible in the first round minimizes the amount of probe data we spill
+	partition_order.resize(num_partitions);
+	for (idx_t partition_idx = 0; partition_idx < num_partitions; partition_idx++) {
+		partition_order[partition_idx] = partition_idx;
+	}
+	std::stable_sort(partition_order.begin(), partition_order.end(), [&](const idx_t lhs, const idx_t rhs) {
+		return partitions[lhs]->SizeInBytes() < partitions[rhs]->SizeInBytes();
+	});
+
+	current_partitions = make_unsafe_uniq_array_uninitialized<bool>(num_partitions);
+	memset(current_partitions.get(), 0, num_partitions * sizeof(bool));
+	partition_start = 0;
+	partition_end = 0;
+}
+
+idx_t JoinHashTable::SelectCurrentPartitions(Vector &hashes, const idx_t count, SelectionVector &true_sel,
+                                             SelectionVector &false_sel) const {
+	UnifiedVectorFormat hashes_data;
+	hashes.ToUnifiedFormat(count, hashes_data);
+	const auto hash_ptr = UnifiedVectorFormat::GetData<hash_t>(hashes_data);
+
+	const auto mask = RadixPartitioning::Mask(radix_bits);
+	const auto shift = RadixPartitioning::Shift(radix_bits);
+
+	idx_t true_count = 0;
+	idx_t false_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto partition_idx = (hash_ptr[hashes_data.sel->get_index(i)] & mask) >> shift;
+		if (current_partitions[partition_idx]) {
+			true_sel.set_index(true_count++, i);
+		} else {
+			false_sel.set_index(false_count++, i);
+		}
+	}
+	return true_count;
+}
+
 static void CreateSpillChunk(DataChunk &spill_chunk, DataChunk &keys, DataChunk &payload, Vector &hashes) {
 	spill_chunk.Reset();
 	idx_t spill_col_idx = 0;
@@ -1482,8 +1587,7 @@ void JoinHashTable::ProbeAndSpill(ScanStructure &scan_structure, DataChunk &keys
 	SelectionVector false_sel;
 	true_sel.Initialize();
 	false_sel.Initialize();
-	auto true_count = RadixPartitioning::Select(hashes, FlatVector::IncrementalSelectionVector(), keys.size(),
-	                                            radix_bits, partition_end, &true_sel, &false_sel);
+	auto true_count = SelectCurrentPartitions(hashes, keys.size(), true_sel, false_sel);
 	auto false_count = keys.size() - true_count;
 
 	CreateSpillChunk(spill_chunk, keys, payload, hashes);
@@ -1504,6 +1608,9 @@ void JoinHashTable::ProbeAndSpill(ScanStructure &scan_structure, DataChunk &keys
 		return;
 	}
 
+	// skip the keys that are definitely not in the HT
+	ApplyBloomFilter(probe_state, hashes, current_sel, scan_structure.count);
+
 	// now initialize the pointers of the scan structure based on the hashes
 	GetRowPointers(keys, key_state, probe_state, hashes, *current_sel, scan_structure.count, scan_structure.pointers,
 	               scan_structure.sel_vector);
@@ -1555,9 +1662,9 @@ void ProbeSpill::PrepareNextProbe() {
 		    make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), probe_types);
 	} else {
 		// Move specific partitions to the global spill collection
-		global_spill_collection = std::move(partitions[ht.partition_start]);
+		global_spill_collection = std::move(partitions[ht.partition_order[ht.partition_start]]);
 		for (idx_t i = ht.partition_start + 1; i < ht.partition_end; i++) {
-			auto &partition = partitions[i];
+			auto &partition = partitions[ht.partition_order[i]];
 			if (global_spill_collection->Count() == 0) {
 				global_spill_collection = std::move(partition);
 			} else {
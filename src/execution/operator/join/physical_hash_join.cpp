@@ -1,6 +1,7 @@
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 
 #include "duckdb/common/radix_partitioning.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/operator/aggregate/ungrouped_aggregate_state.hpp"
 #include "duckdb/function/aggregate/distributive_functions.hpp"
@@ -14,7 +15,9 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -109,6 +112,67 @@ unique_ptr<JoinFilterGlobalState> JoinFilterPushdownInfo::GetGlobalState(ClientC
 	return result;
 }
 
+static idx_t GetTupleWidth(const vector<LogicalType> &types, bool &all_constant) {
+	idx_t tuple_width = 0;
+	all_constant = true;
+	for (auto &type : types) {
+		tuple_width += GetTypeIdSize(type.InternalType());
+		all_constant &= TypeIsConstantSize(type.InternalType());
+	}
+	return tuple_width + AlignValue(types.size()) / 8 + GetTypeIdSize(PhysicalType::UINT64);
+}
+
+static idx_t GetPartitioningSpaceRequirement(ClientContext &context, const vector<LogicalType> &types,
+                                             const idx_t radix_bits, const idx_t num_threads) {
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	bool all_constant;
+	idx_t tuple_width = GetTupleWidth(types, all_constant);
+
+	auto tuples_per_block = buffer_manager.GetBlockSize() / tuple_width;
+	auto blocks_per_chunk = (STANDARD_VECTOR_SIZE + tuples_per_block) / tuples_per_block + 1;
+	if (!all_constant) {
+		blocks_per_chunk += 2;
+	}
+	auto size_per_partition = blocks_per_chunk * buffer_manager.GetBlockAllocSize();
+	auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
+
+	return num_threads * num_partitions * size_per_partition;
+}
+
+//! Choose the number of radix bits that the build side is partitioned with while sinking
+//! If the estimated build side does not fit in the memory that we would get, we partition it more finely right away,
+//! so we do not have to repartition all of the materialized data in Finalize
+static idx_t GetInitialRadixBits(ClientContext &context, const PhysicalHashJoin &op,
+                                 TemporaryMemoryState &temporary_memory_state, const idx_t num_threads) {
+	// Cardinality estimates can be way off, clamp them so the computations below do not overflow
+	static constexpr idx_t MAXIMUM_ESTIMATED_COUNT = idx_t(1) << 40;
+	const auto estimated_count = MinValue<idx_t>(op.children[1]->estimated_cardinality, MAXIMUM_ESTIMATED_COUNT);
+	bool all_constant;
+	const auto estimated_size = estimated_count * GetTupleWidth(op.children[1]->types, all_constant) +
+	                            JoinHashTable::PointerTableSize(estimated_count);
+
+	// Ask for as much memory as the build side needs, and see how much we would get (but do not hold on to it yet)
+	const auto remaining_size = temporary_memory_state.GetRemainingSize();
+	temporary_memory_state.SetRemainingSizeAndUpdateReservation(context, estimated_size);
+	const auto reservation = temporary_memory_state.GetReservation();
+	temporary_memory_state.SetRemainingSizeAndUpdateReservation(context, remaining_size);
+	if (estimated_size <= reservation) {
+		return JoinHashTable::INITIAL_RADIX_BITS;
+	}
+
+	// Aim for an estimated partition size of reservation / 4 (like SetRepartitionRadixBits),
+	// without spending more than half of the reservation on partitioning the build side.
+	// We leave at least one bit for repartitioning in case the estimate was too low
+	auto radix_bits = JoinHashTable::INITIAL_RADIX_BITS;
+	while (radix_bits + 1 < RadixPartitioning::MAX_RADIX_BITS &&
+	       estimated_size / RadixPartitioning::NumberOfPartitions(radix_bits) > reservation / 4 &&
+	       GetPartitioningSpaceRequirement(context, op.children[1]->types, radix_bits + 1, num_threads) <=
+	           reservation / 2) {
+		radix_bits++;
+	}
+	return radix_bits;
+}
+
 class HashJoinGlobalSinkState : public GlobalSinkState {
 public:
 	HashJoinGlobalSinkState(const PhysicalHashJoin &op_p, ClientContext &context_p)
@@ -117,6 +181,7 @@ public:
 	      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), finalized(false),
 	      active_local_states(0), total_size(0), max_partition_size(0), max_partition_count(0), scanned_data(false) {
 		hash_table = op.InitializeHashTable(context);
+		hash_table->SetInitialRadixBits(GetInitialRadixBits(context, op, *temporary_memory_state, num_threads));
 
 		// For perfect hash join
 		perfect_join_executor = make_uniq<PerfectHashJoinExecutor>(op, *hash_table, op.perfect_join_statistics);
@@ -195,6 +260,7 @@ public:
 		}
 
 		hash_table = op.InitializeHashTable(context);
+		hash_table->SetInitialRadixBits(gstate.hash_table->GetRadixBits());
 		hash_table->GetSinkCollection().InitializeAppendState(append_state);
 
 		gstate.active_local_states++;
@@ -347,33 +413,6 @@ SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, Opera
 //===--------------------------------------------------------------------===//
 // Finalize
 //===--------------------------------------------------------------------===//
-static idx_t GetTupleWidth(const vector<LogicalType> &types, bool &all_constant) {
-	idx_t tuple_width = 0;
-	all_constant = true;
-	for (auto &type : types) {
-		tuple_width += GetTypeIdSize(type.InternalType());
-		all_constant &= TypeIsConstantSize(type.InternalType());
-	}
-	return tuple_width + AlignValue(types.size()) / 8 + GetTypeIdSize(PhysicalType::UINT64);
-}
-
-static idx_t GetPartitioningSpaceRequirement(ClientContext &context, const vector<LogicalType> &types,
-                                             const idx_t radix_bits, const idx_t num_threads) {
-	auto &buffer_manager = BufferManager::GetBufferManager(context);
-	bool all_constant;
-	idx_t tuple_width = GetTupleWidth(types, all_constant);
-
-	auto tuples_per_block = buffer_manager.GetBlockSize() / tuple_width;
-	auto blocks_per_chunk = (STANDARD_VECTOR_SIZE + tuples_per_block) / tuples_per_block + 1;
-	if (!all_constant) {
-		blocks_per_chunk += 2;
-	}
-	auto size_per_partition = blocks_per_chunk * buffer_manager.GetBlockAllocSize();
-	auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
-
-	return num_threads * num_partitions * size_per_partition;
-}
-
 void PhysicalHashJoin::PrepareFinalize(ClientContext &context, GlobalSinkState &global_state) const {
 	auto &gstate = global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *gstate.hash_table;
@@ -500,7 +539,9 @@ public:
 
 public:
 	void Schedule() override {
-		D_ASSERT(sink.hash_table->GetRadixBits() > JoinHashTable::INITIAL_RADIX_BITS);
+		D_ASSERT(!local_hts.empty());
+		const auto local_radix_bits = local_hts[0]->GetRadixBits();
+		D_ASSERT(sink.hash_table->GetRadixBits() > local_radix_bits);
 		auto block_size = sink.hash_table->buffer_manager.GetBlockSize();
 
 		idx_t total_size = 0;
@@ -516,7 +557,7 @@ public:
 
 		// Assume 8 blocks per partition per thread (4 input, 4 output)
 		auto partition_multiplier =
-		    RadixPartitioning::NumberOfPartitions(sink.hash_table->GetRadixBits() - JoinHashTable::INITIAL_RADIX_BITS);
+		    RadixPartitioning::NumberOfPartitions(sink.hash_table->GetRadixBits() - local_radix_bits);
 		auto thread_memory = 2 * blocks_per_vector * partition_multiplier * block_size;
 		auto repartition_threads = MaxValue<idx_t>(sink.temporary_memory_state->GetReservation() / thread_memory, 1);
 
@@ -561,7 +602,91 @@ public:
 	}
 };
 
-void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+void JoinFilterPushdownInfo::PushInFilters(JoinHashTable &ht, const PhysicalOperator &op,
+                                           const vector<idx_t> &filter_idxs) const {
+	if (filter_idxs.empty()) {
+		return;
+	}
+	D_ASSERT(ht.Count() <= IN_FILTER_MAX_BUILD_SIZE);
+
+	// scan the join keys from the hash table and collect them
+	vector<column_t> column_ids;
+	for (auto &filter_idx : filter_idxs) {
+		column_ids.push_back(filters[filter_idx].join_condition);
+	}
+	vector<vector<Value>> in_values(filter_idxs.size());
+
+	auto &data_collection = ht.GetDataCollection();
+	TupleDataScanState scan_state;
+	data_collection.InitializeScan(scan_state, column_ids);
+	DataChunk keys;
+	data_collection.InitializeScanChunk(scan_state, keys);
+	while (data_collection.Scan(scan_state, keys)) {
+		for (idx_t col_idx = 0; col_idx < keys.ColumnCount(); col_idx++) {
+			for (idx_t row_idx = 0; row_idx < keys.size(); row_idx++) {
+				auto value = keys.data[col_idx].GetValue(row_idx);
+				if (!value.IsNull()) {
+					in_values[col_idx].push_back(std::move(value));
+				}
+			}
+		}
+	}
+
+	for (idx_t i = 0; i < filter_idxs.size(); i++) {
+		auto &values = in_values[i];
+		if (values.empty()) {
+			continue;
+		}
+		// remove duplicate keys
+		std::sort(values.begin(), values.end());
+		values.erase(std::unique(values.begin(), values.end()), values.end());
+
+		auto &filter = filters[filter_idxs[i]];
+		dynamic_filters->PushFilter(op, filter.probe_column_index.column_index, make_uniq<InFilter>(std::move(values)));
+	}
+}
+
+void JoinFilterPushdownInfo::PushBloomFilters(JoinHashTable &ht, const PhysicalOperator &op,
+                                              const vector<idx_t> &filter_idxs) const {
+	if (filter_idxs.empty()) {
+		return;
+	}
+	const auto build_count = ht.Count();
+	if (build_count > BLOOM_FILTER_MAX_BUILD_SIZE || build_count >= op.children[0]->estimated_cardinality) {
+		// the Bloom filter would not fit in cache, or the build side is unlikely to be selective on the probe side
+		return;
+	}
+
+	// scan the join keys from the hash table and hash them into one Bloom filter per pushed down column
+	vector<column_t> column_ids;
+	vector<shared_ptr<BlockedBloomFilter>> bloom_filters;
+	for (auto &filter_idx : filter_idxs) {
+		column_ids.push_back(filters[filter_idx].join_condition);
+		bloom_filters.push_back(make_shared_ptr<BlockedBloomFilter>(build_count));
+	}
+
+	auto &data_collection = ht.GetDataCollection();
+	TupleDataScanState scan_state;
+	data_collection.InitializeScan(scan_state, column_ids);
+	DataChunk keys;
+	data_collection.InitializeScanChunk(scan_state, keys);
+	Vector hashes(LogicalType::HASH);
+	while (data_collection.Scan(scan_state, keys)) {
+		for (idx_t col_idx = 0; col_idx < keys.ColumnCount(); col_idx++) {
+			VectorOperations::Hash(keys.data[col_idx], hashes, keys.size());
+			bloom_filters[col_idx]->Insert(hashes, keys.size());
+		}
+	}
+
+	for (idx_t i = 0; i < filter_idxs.size(); i++) {
+		auto &filter = filters[filter_idxs[i]];
+		auto bloom_filter = make_uniq<BloomFilter>(keys.data[i].GetType(), std::move(bloom_filters[i]));
+		dynamic_filters->PushFilter(op, filter.probe_column_index.column_index, std::move(bloom_filter));
+	}
+}
+
+void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, JoinHashTable &ht,
+                                         const PhysicalOperator &op) const {
 	// finalize the min/max aggregates
 	vector<LogicalType> min_max_types;
 	for (auto &aggr_expr : min_max_aggregates) {
@@ -573,6 +698,8 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 	gstate.global_aggregate_state->Finalize(final_min_max);
 
 	// create a filter for each of the aggregates
+	vector<idx_t> in_filter_idxs;
+	vector<idx_t> bloom_filter_idxs;
 	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
 		auto &filter = filters[filter_idx];
 		auto filter_col_idx = filter.probe_column_index.column_index;
@@ -598,10 +725,19 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 			dynamic_filters->PushFilter(op, filter_col_idx, std::move(greater_equals));
 			auto less_equals = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val));
 			dynamic_filters->PushFilter(op, filter_col_idx, std::move(less_equals));
+			// the range might still contain many values that are not in the build side
+			// for small build sides we push the exact set of keys, otherwise we try a Bloom filter
+			if (in_filter_pushdown && ht.Count() <= IN_FILTER_MAX_BUILD_SIZE) {
+				in_filter_idxs.push_back(filter_idx);
+			} else {
+				bloom_filter_idxs.push_back(filter_idx);
+			}
 		}
 		// not null filter
 		dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<IsNotNullFilter>());
 	}
+	PushInFilters(ht, op, in_filter_idxs);
+	PushBloomFilters(ht, op, bloom_filter_idxs);
 }
 
 SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
@@ -647,7 +783,7 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	ht.Unpartition();
 
 	if (filter_pushdown && ht.Count() > 0) {
-		filter_pushdown->PushFilters(*sink.global_filter_state, *this);
+		filter_pushdown->PushFilters(*sink.global_filter_state, ht, *this);
 	}
 
 	// check for possible perfect hash table
@@ -6,14 +6,15 @@
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
 
 PhysicalTopN::PhysicalTopN(vector<LogicalType> types, vector<BoundOrderByNode> orders, idx_t limit, idx_t offset,
-                           idx_t estimated_cardinality)
+                           shared_ptr<DynamicFilterData> dynamic_filter_p, idx_t estimated_cardinality)
     : PhysicalOperator(PhysicalOperatorType::TOP_N, std::move(types), estimated_cardinality), orders(std::move(orders)),
-      limit(limit), offset(offset) {
+      limit(limit), offset(offset), dynamic_filter(std::move(dynamic_filter_p)) {
 }
 
 //===--------------------------------------------------------------------===//
@@ -84,7 +85,8 @@ public:
 public:
 	void Sink(DataChunk &input);
 	void Combine(TopNHeap &other);
-	void Reduce();
+	//! Reduce the heap to the Top N (if it is large enough), returns true if the boundary values were updated
+	bool Reduce();
 	void Finalize();
 
 	void ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk);
@@ -275,11 +277,11 @@ void TopNHeap::Finalize() {
 	sort_state.Finalize();
 }
 
-void TopNHeap::Reduce() {
+bool TopNHeap::Reduce() {
 	idx_t min_sort_threshold = MaxValue<idx_t>(STANDARD_VECTOR_SIZE * 5ULL, 2ULL * (limit + offset));
 	if (sort_state.count < min_sort_threshold) {
 		// only reduce when we pass two times the limit + offset, or 5 vectors (whichever comes first)
-		return;
+		return false;
 	}
 	sort_state.Finalize();
 	TopNSortState new_state(*this);
@@ -306,6 +308,7 @@ void TopNHeap::Reduce() {
 	}
 
 	sort_state.Move(new_state);
+	return has_boundary_values;
 }
 
 void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk) {
@@ -407,8 +410,42 @@ public:
 
 	mutex lock;
 	TopNHeap heap;
+
+	//! Protects the boundary
+	mutex boundary_lock;
+	//! The tightest boundary of the first order that any of the heaps has found so far (NULL if none)
+	Value boundary;
+
+public:
+	//! Publish the boundary of a (full) heap in the dynamic filter, if it is tighter than the current boundary
+	void UpdateBoundary(const PhysicalTopN &op, TopNHeap &source_heap);
 };
 
+void TopNGlobalState::UpdateBoundary(const PhysicalTopN &op, TopNHeap &source_heap) {
+	if (!op.dynamic_filter || !source_heap.has_boundary_values) {
+		return;
+	}
+	auto new_boundary = source_heap.boundary_values.GetValue(0, 0);
+	if (new_boundary.IsNull()) {
+		// the heap is filled with NULL values - we cannot filter anything
+		return;
+	}
+	auto &order = op.orders[0];
+	lock_guard<mutex> guard(boundary_lock);
+	if (!boundary.IsNull()) {
+		// the boundary can only become tighter
+		bool is_tighter = order.type == OrderType::ASCENDING ? new_boundary < boundary : new_boundary > boundary;
+		if (!is_tighter) {
+			return;
+		}
+	}
+	boundary = new_boundary;
+	// rows that are equal to the boundary in the first order can still make it into the Top N based on the other orders
+	auto comparison_type = order.type == OrderType::ASCENDING ? ExpressionType::COMPARE_LESSTHANOREQUALTO
+	                                                          : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+	op.dynamic_filter->SetValue(comparison_type, std::move(new_boundary));
+}
+
 class TopNLocalState : public LocalSinkState {
 public:
 	TopNLocalState(ExecutionContext &context, const vector<LogicalType> &payload_types,
@@ -424,6 +461,11 @@ unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &con
 }
 
 unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &context) const {
+	if (dynamic_filter) {
+		// the dynamic filter is part of the plan, which can be executed multiple times (e.g. prepared statements)
+		// clear the boundary of the previous execution
+		dynamic_filter->Reset();
+	}
 	return make_uniq<TopNGlobalState>(context, types, orders, limit, offset);
 }
 
@@ -434,7 +476,11 @@ SinkResultType PhysicalTopN::Sink(ExecutionContext &context, DataChunk &chunk, O
 	// append to the local sink state
 	auto &sink = input.local_state.Cast<TopNLocalState>();
 	sink.heap.Sink(chunk);
-	sink.heap.Reduce();
+	if (sink.heap.Reduce()) {
+		// the heap has a new boundary - let the scan know
+		auto &gstate = input.global_state.Cast<TopNGlobalState>();
+		gstate.UpdateBoundary(*this, sink.heap);
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -448,6 +494,7 @@ SinkCombineResultType PhysicalTopN::Combine(ExecutionContext &context, OperatorS
 	// scan the local top N and append it to the global heap
 	lock_guard<mutex> glock(gstate.lock);
 	gstate.heap.Combine(lstate.heap);
+	gstate.UpdateBoundary(*this, gstate.heap);
 
 	return SinkCombineResultType::FINISHED;
 }
@@ -0,0 +1,153 @@
+#include "duckdb/execution/operator/schema/physical_create_btree_index.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_index_entry.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/common/exception/transaction_exception.hpp"
+
+namespace duckdb {
+
+PhysicalCreateBTreeIndex::PhysicalCreateBTreeIndex(LogicalOperator &op, TableCatalogEntry &table_p,
+                                                   const vector<column_t> &column_ids,
+                                                   unique_ptr<CreateIndexInfo> info,
+                                                   vector<unique_ptr<Expression>> unbound_expressions,
+                                                   idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::CREATE_INDEX, op.types, estimated_cardinality),
+      table(table_p.Cast<DuckTableEntry>()), info(std::move(info)),
+      unbound_expressions(std::move(unbound_expressions)) {
+
+	// Convert the virtual column ids to physical column ids.
+	for (auto &column_id : column_ids) {
+		storage_ids.push_back(table.GetColumns().LogicalToPhysical(LogicalIndex(column_id)).index);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+
+class CreateBTreeIndexGlobalSinkState : public GlobalSinkState {
+public:
+	unique_ptr<BoundIndex> global_index;
+	//! The local indexes of the threads, merged into the global index in a single pass when finalizing
+	mutex local_indexes_lock;
+	vector<unique_ptr<BoundIndex>> local_indexes;
+};
+
+class CreateBTreeIndexLocalSinkState : public LocalSinkState {
+public:
+	unique_ptr<BoundIndex> local_index;
+	DataChunk key_chunk;
+	vector<column_t> key_column_ids;
+};
+
+unique_ptr<GlobalSinkState> PhysicalCreateBTreeIndex::GetGlobalSinkState(ClientContext &context) const {
+	// Create the global sink state and add the global index.
+	auto state = make_uniq<CreateBTreeIndexGlobalSinkState>();
+	auto &storage = table.GetStorage();
+	state->global_index = make_uniq<BTree>(info->index_name, info->constraint_type, storage_ids,
+	                                       TableIOManager::Get(storage), unbound_expressions, storage.db);
+	return (std::move(state));
+}
+
+unique_ptr<LocalSinkState> PhysicalCreateBTreeIndex::GetLocalSinkState(ExecutionContext &context) const {
+	// Create the local sink state and add the local index.
+	auto state = make_uniq<CreateBTreeIndexLocalSinkState>();
+	auto &storage = table.GetStorage();
+	state->local_index = make_uniq<BTree>(info->index_name, info->constraint_type, storage_ids,
+	                                      TableIOManager::Get(storage), unbound_expressions, storage.db);
+
+	// Initialize the local sink state.
+	state->key_chunk.Initialize(Allocator::Get(context.client), state->local_index->logical_types);
+	for (idx_t i = 0; i < state->key_chunk.ColumnCount(); i++) {
+		state->key_column_ids.push_back(i);
+	}
+	return std::move(state);
+}
+
+SinkResultType PhysicalCreateBTreeIndex::Sink(ExecutionContext &context, DataChunk &chunk,
+                                              OperatorSinkInput &input) const {
+
+	D_ASSERT(chunk.ColumnCount() >= 2);
+	auto &l_state = input.local_state.Cast<CreateBTreeIndexLocalSinkState>();
+	l_state.key_chunk.ReferenceColumns(chunk, l_state.key_column_ids);
+
+	// The expressions are already executed, so we insert the keys directly.
+	IndexLock lock;
+	l_state.local_index->InitializeLock(lock);
+	auto error = l_state.local_index->Insert(lock, l_state.key_chunk, chunk.data[chunk.ColumnCount() - 1]);
+	if (error.HasError()) {
+		error.Throw();
+	}
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType PhysicalCreateBTreeIndex::Combine(ExecutionContext &context,
+                                                        OperatorSinkCombineInput &input) const {
+
+	auto &g_state = input.global_state.Cast<CreateBTreeIndexGlobalSinkState>();
+	auto &l_state = input.local_state.Cast<CreateBTreeIndexLocalSinkState>();
+
+	// keep the local index, so that all of them can be merged into the global index at once
+	lock_guard<mutex> guard(g_state.local_indexes_lock);
+	g_state.local_indexes.push_back(std::move(l_state.local_index));
+	return SinkCombineResultType::FINISHED;
+}
+
+SinkFinalizeType PhysicalCreateBTreeIndex::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                    OperatorSinkFinalizeInput &input) const {
+
+	// here, we set the resulting global index as the newly created index of the table
+	auto &state = input.global_state.Cast<CreateBTreeIndexGlobalSinkState>();
+
+	// merge the local indexes into the global index
+	vector<reference<BTree>> local_trees;
+	for (auto &local_index : state.local_indexes) {
+		local_trees.push_back(local_index->Cast<BTree>());
+	}
+	{
+		IndexLock lock;
+		auto &global_tree = state.global_index->Cast<BTree>();
+		global_tree.InitializeLock(lock);
+		global_tree.MergeIndexes(lock, local_trees);
+	}
+	state.local_indexes.clear();
+
+	// vacuum excess memory and verify
+	state.global_index->Vacuum();
+	D_ASSERT(!state.global_index->VerifyAndToString(true).empty());
+	state.global_index->VerifyAllocations();
+
+	auto &storage = table.GetStorage();
+	if (!storage.IsRoot()) {
+		throw TransactionException("Transaction conflict: cannot add an index to a table that has been altered!");
+	}
+
+	auto &schema = table.schema;
+	info->column_ids = storage_ids;
+	auto index_entry = schema.CreateIndex(schema.GetCatalogTransaction(context), *info, table).get();
+	if (!index_entry) {
+		D_ASSERT(info->on_conflict == OnCreateConflict::IGNORE_ON_CONFLICT);
+		// index already exists, but error ignored because of IF NOT EXISTS
+		return SinkFinalizeType::READY;
+	}
+	auto &index = index_entry->Cast<DuckIndexEntry>();
+	index.initial_index_size = state.global_index->GetInMemorySize();
+
+	// add index to storage
+	storage.AddIndex(std::move(state.global_index));
+	return SinkFinalizeType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+
+SourceResultType PhysicalCreateBTreeIndex::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                   OperatorSourceInput &input) const {
+	return SourceResultType::FINISHED;
+}
+
+} // namespace duckdb
@@ -3,6 +3,7 @@
 #include "duckdb/execution/operator/filter/physical_filter.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/operator/schema/physical_create_art_index.hpp"
+#include "duckdb/execution/operator/schema/physical_create_btree_index.hpp"
 #include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/planner/operator/logical_create_index.hpp"
@@ -30,10 +31,10 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCreateInde
 		}
 	}
 
-	// if we get here and the index type is not ART, we throw an exception
+	// if we get here and the index type is neither ART nor BTREE, we throw an exception
 	// because we don't support any other index type yet. However, an operator extension could have
 	// replaced this part of the plan with a different index creation operator.
-	if (op.info->index_type != ART::TYPE_NAME) {
+	if (op.info->index_type != ART::TYPE_NAME && op.info->index_type != BTree::TYPE_NAME) {
 		throw BinderException("Unknown index type: " + op.info->index_type);
 	}
 
@@ -76,6 +77,15 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCreateInde
 	null_filter->types.emplace_back(LogicalType::ROW_TYPE);
 	null_filter->children.push_back(std::move(projection));
 
+	if (op.info->index_type == BTree::TYPE_NAME) {
+		// the B+-tree sorts its entries itself, so we do not need an order operator
+		auto physical_create_index =
+		    make_uniq<PhysicalCreateBTreeIndex>(op, op.table, op.info->column_ids, std::move(op.info),
+		                                        std::move(op.unbound_expressions), op.estimated_cardinality);
+		physical_create_index->children.push_back(std::move(null_filter));
+		return std::move(physical_create_index);
+	}
+
 	// determine if we sort the data prior to index creation
 	// we don't sort, if either VARCHAR or compound key
 	auto perform_sorting = true;
@@ -142,6 +142,8 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+	//! If at least this fraction of the rows sunk into a full thread-local HT were new groups, we stop probing it
+	static constexpr const double SKIP_LOOKUPS_THRESHOLD = 0.95;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -332,12 +334,15 @@ public:
 	unique_ptr<GroupedAggregateHashTable> ht;
 	//! Chunk with group columns
 	DataChunk group_chunk;
+	//! Number of rows sunk into the HT since its count was last reset
+	idx_t sink_count;
 
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
 };
 
-RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht) {
+RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht)
+    : sink_count(0) {
 	// If there are no groups we create a fake group so everything has the same group
 	group_chunk.InitializeEmpty(radix_ht.group_types);
 	if (radix_ht.grouping_set.empty()) {
@@ -441,6 +446,17 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 	return true;
 }
 
+void MaybeSkipLookups(RadixHTLocalSinkState &lstate) {
+	auto &ht = *lstate.ht;
+	if (ht.IsSkippingLookups() || lstate.sink_count == 0) {
+		return; // Once we skip lookups, we can no longer measure the reduction, so we never switch back
+	}
+	const auto new_group_fraction = static_cast<double>(ht.Count()) / static_cast<double>(lstate.sink_count);
+	if (new_group_fraction >= RadixHTConfig::SKIP_LOOKUPS_THRESHOLD) {
+		ht.SetSkipLookups(true);
+	}
+}
+
 void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input,
                                      DataChunk &payload_input, const unsafe_vector<idx_t> &filter) const {
 	auto &gstate = input.global_state.Cast<RadixHTGlobalSinkState>();
@@ -455,16 +471,24 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 
 	auto &ht = *lstate.ht;
 	ht.AddChunk(group_chunk, payload_input, filter);
+	lstate.sink_count += group_chunk.size();
 
 	if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
 		return; // We can fit another chunk
 	}
 
 	if (gstate.number_of_threads > 2) {
+		// The HT is full, check how much it reduced the data: if almost all rows were new groups, the lookups are
+		// wasted because the data is aggregated again when it is finalized, so we just append the rows from now on
+		MaybeSkipLookups(lstate);
+
 		// 'Reset' the HT without taking its data, we can just keep appending to the same collection
 		// This only works because we never resize the HT
-		ht.ClearPointerTable();
+		if (!ht.IsSkippingLookups()) {
+			ht.ClearPointerTable();
+		}
 		ht.ResetCount();
+		lstate.sink_count = 0;
 		// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
 	}
 
@@ -475,6 +499,7 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 		// We repartitioned, but we didn't clear the pointer table / reset the count because we're on 1 or 2 threads
 		ht.ClearPointerTable();
 		ht.ResetCount();
+		lstate.sink_count = 0;
 	}
 
 	// TODO: combine early and often
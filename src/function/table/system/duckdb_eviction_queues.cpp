@@ -0,0 +1,80 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBEvictionQueuesData : public GlobalTableFunctionState {
+	DuckDBEvictionQueuesData() : offset(0) {
+	}
+
+	vector<EvictionQueueInformation> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBEvictionQueuesBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("buffer_type");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("protected");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+
+	names.emplace_back("insertions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("evictions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("ghost_hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBEvictionQueuesInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBEvictionQueuesData>();
+
+	result->entries = BufferManager::GetBufferManager(context).GetBufferPool().GetEvictionQueueInformation();
+	return std::move(result);
+}
+
+void DuckDBEvictionQueuesFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBEvictionQueuesData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// buffer_type, VARCHAR
+		output.SetValue(col++, count, EnumUtil::ToString(entry.type));
+		// protected, BOOLEAN
+		output.SetValue(col++, count, Value::BOOLEAN(entry.protected_queue));
+		// insertions, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.insertions)));
+		// hits, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.hits)));
+		// evictions, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.evictions)));
+		// ghost_hits, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.ghost_hits)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBEvictionQueuesFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_eviction_queues", {}, DuckDBEvictionQueuesFunction,
+	                              DuckDBEvictionQueuesBind, DuckDBEvictionQueuesInit));
+}
+
+} // namespace duckdb
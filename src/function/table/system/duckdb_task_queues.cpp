@@ -0,0 +1,83 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+namespace duckdb {
+
+struct DuckDBTaskQueuesData : public GlobalTableFunctionState {
+	DuckDBTaskQueuesData() : offset(0) {
+	}
+
+	vector<TaskQueueInformation> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBTaskQueuesBind(ClientContext &context, TableFunctionBindInput &input,
+                                                     vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("queue_id");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("queued_tasks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("scheduled_tasks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("local_tasks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("stolen_tasks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("idle_time_us");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBTaskQueuesInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBTaskQueuesData>();
+
+	result->entries = TaskScheduler::GetScheduler(context).GetTaskQueueInformation();
+	return std::move(result);
+}
+
+void DuckDBTaskQueuesFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBTaskQueuesData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// queue_id, BIGINT (NULL for the shared queue)
+		if (entry.queue_idx == DConstants::INVALID_INDEX) {
+			output.SetValue(col++, count, Value());
+		} else {
+			output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.queue_idx)));
+		}
+		// queued_tasks, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.queued_tasks)));
+		// scheduled_tasks, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.scheduled_tasks)));
+		// local_tasks, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.local_tasks)));
+		// stolen_tasks, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.stolen_tasks)));
+		// idle_time_us, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.idle_time_us)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBTaskQueuesFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_task_queues", {}, DuckDBTaskQueuesFunction, DuckDBTaskQueuesBind, DuckDBTaskQueuesInit));
+}
+
+} // namespace duckdb
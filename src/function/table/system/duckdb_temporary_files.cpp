@@ -19,6 +19,15 @@ static unique_ptr<FunctionData> DuckDBTemporaryFilesBind(ClientContext &context,
 	names.emplace_back("size");
 	return_types.emplace_back(LogicalType::BIGINT);
 
+	names.emplace_back("slot_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("block_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("uncompressed_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
 	return nullptr;
 }
 
@@ -46,6 +55,12 @@ void DuckDBTemporaryFilesFunction(ClientContext &context, TableFunctionInput &da
 		output.SetValue(col++, count, entry.path);
 		// database_oid, BIGINT
 		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.size)));
+		// slot_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.slot_size)));
+		// block_count, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.block_count)));
+		// uncompressed_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.uncompressed_size)));
 		count++;
 	}
 	output.SetCardinality(count);
@@ -0,0 +1,121 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/write_ahead_log.hpp"
+
+namespace duckdb {
+
+struct WALGroupCommitEntry {
+	string database_name;
+	WALCommitStatistics statistics;
+};
+
+struct DuckDBWALGroupCommitData : public GlobalTableFunctionState {
+	DuckDBWALGroupCommitData() : offset(0) {
+	}
+
+	vector<WALGroupCommitEntry> entries;
+	bool group_commit = false;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBWALGroupCommitBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("database_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("group_commit");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+
+	names.emplace_back("commits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("syncs");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("max_batch_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("avg_batch_size");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("total_sync_time_us");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("max_sync_time_us");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBWALGroupCommitInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBWALGroupCommitData>();
+	result->group_commit = DBConfig::GetConfig(context).options.wal_group_commit;
+
+	// collect the commit statistics of every database that has a WAL
+	auto &db_manager = DatabaseManager::Get(context);
+	for (auto &db_ref : db_manager.GetDatabases(context)) {
+		auto &db = db_ref.get();
+		if (db.IsSystem() || db.IsTemporary()) {
+			continue;
+		}
+		auto wal = db.GetStorageManager().GetWAL();
+		if (!wal) {
+			continue;
+		}
+		WALGroupCommitEntry entry;
+		entry.database_name = db.GetName();
+		entry.statistics = wal->GetCommitStatistics();
+		result->entries.push_back(std::move(entry));
+	}
+	return std::move(result);
+}
+
+void DuckDBWALGroupCommitFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBWALGroupCommitData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		auto &stats = entry.statistics;
+		// return values:
+		idx_t col = 0;
+		// database_name, VARCHAR
+		output.SetValue(col++, count, Value(entry.database_name));
+		// group_commit, BOOLEAN
+		output.SetValue(col++, count, Value::BOOLEAN(data.group_commit));
+		// commits, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(stats.commits)));
+		// syncs, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(stats.syncs)));
+		// max_batch_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(stats.max_batch_size)));
+		// avg_batch_size, DOUBLE (NULL if the WAL was never synced)
+		if (stats.syncs == 0) {
+			output.SetValue(col++, count, Value());
+		} else {
+			output.SetValue(col++, count,
+			                Value::DOUBLE(static_cast<double>(stats.commits) / static_cast<double>(stats.syncs)));
+		}
+		// total_sync_time_us, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(stats.total_sync_time_us)));
+		// max_sync_time_us, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(stats.max_sync_time_us)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBWALGroupCommitFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_wal_group_commit", {}, DuckDBWALGroupCommitFunction,
+	                              DuckDBWALGroupCommitBind, DuckDBWALGroupCommitInit));
+}
+
+} // namespace duckdb
@@ -0,0 +1,124 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/write_ahead_log.hpp"
+
+namespace duckdb {
+
+struct WALReplayEntry {
+	string database_name;
+	WALReplayStatistics statistics;
+};
+
+struct DuckDBWALReplayData : public GlobalTableFunctionState {
+	DuckDBWALReplayData() : offset(0) {
+	}
+
+	vector<WALReplayEntry> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBWALReplayBind(ClientContext &context, TableFunctionBindInput &input,
+                                                    vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("database_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("wal_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("replayed_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("progress");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("entries");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("transactions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("insert_batches");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("replay_threads");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("replay_time_us");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("checkpointed");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBWALReplayInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBWALReplayData>();
+
+	// collect the replay statistics of every database that replayed a WAL when it was loaded
+	auto &db_manager = DatabaseManager::Get(context);
+	for (auto &db_ref : db_manager.GetDatabases(context)) {
+		auto &db = db_ref.get();
+		if (db.IsSystem() || db.IsTemporary()) {
+			continue;
+		}
+		auto &statistics = db.GetStorageManager().GetWALReplayStatistics();
+		if (statistics.wal_size == 0) {
+			continue;
+		}
+		WALReplayEntry entry;
+		entry.database_name = db.GetName();
+		entry.statistics = statistics;
+		result->entries.push_back(std::move(entry));
+	}
+	return std::move(result);
+}
+
+void DuckDBWALReplayFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBWALReplayData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		auto &stats = entry.statistics;
+		// return values:
+		idx_t col = 0;
+		// database_name, VARCHAR
+		output.SetValue(col++, count, Value(entry.database_name));
+		// wal_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(stats.wal_size)));
+		// replayed_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(stats.replayed_bytes)));
+		// progress, DOUBLE (the percentage of the WAL that was replayed)
+		auto progress = 100.0 * static_cast<double>(stats.replayed_bytes) / static_cast<double>(stats.wal_size);
+		output.SetValue(col++, count, Value::DOUBLE(progress));
+		// entries, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(stats.entries)));
+		// transactions, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(stats.transactions)));
+		// insert_batches, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(stats.insert_batches)));
+		// replay_threads, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(stats.replay_threads)));
+		// replay_time_us, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(stats.replay_time_us)));
+		// checkpointed, BOOLEAN
+		output.SetValue(col++, count, Value::BOOLEAN(stats.checkpointed));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBWALReplayFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_wal_replay", {}, DuckDBWALReplayFunction, DuckDBWALReplayBind, DuckDBWALReplayInit));
+}
+
+} // namespace duckdb
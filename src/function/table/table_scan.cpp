@@ -6,6 +6,7 @@
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/btree/btree.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_config.hpp"
@@ -325,17 +326,17 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 	auto checkpoint_lock = storage.GetSharedCheckpointLock();
 	auto &info = storage.GetDataTableInfo();
 
-	// bind and scan any ART indexes
-	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
+	// try to scan an index for any of the filters
+	auto try_index_scan = [&](BoundIndex &index) {
 		// first rewrite the index expression so the ColumnBindings align with the column bindings of the current table
-		if (art_index.unbound_expressions.size() > 1) {
+		if (index.unbound_expressions.size() > 1) {
 			// NOTE: index scans are not (yet) supported for compound index keys
 			return false;
 		}
 
-		auto index_expression = art_index.unbound_expressions[0]->Copy();
+		auto index_expression = index.unbound_expressions[0]->Copy();
 		bool rewrite_possible = true;
-		RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
+		RewriteIndexExpression(index, get, *index_expression, rewrite_possible);
 		if (!rewrite_possible) {
 			// could not rewrite!
 			return false;
@@ -343,7 +344,7 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 
 		// Try to find a matching index for any of the filter expressions.
 		for (auto &filter : filters) {
-			auto index_state = art_index.TryInitializeScan(*index_expression, *filter);
+			auto index_state = index.TryInitializeScan(*index_expression, *filter);
 			if (index_state != nullptr) {
 
 				auto &db_config = DBConfig::GetConfig(context);
@@ -355,7 +356,7 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 				auto max_count = MaxValue(index_scan_max_count, total_rows_from_percentage);
 
 				// Check if we can use an index scan, and already retrieve the matching row ids.
-				if (art_index.Scan(*index_state, max_count, bind_data.row_ids)) {
+				if (index.Scan(*index_state, max_count, bind_data.row_ids)) {
 					bind_data.is_index_scan = true;
 					get.function = TableScanFunction::GetIndexScanFunction();
 					return true;
@@ -367,7 +368,14 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 			}
 		}
 		return false;
-	});
+	};
+
+	// bind and scan any ART indexes, and then any B+-tree indexes
+	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &index) { return try_index_scan(index); });
+	if (bind_data.is_index_scan) {
+		return;
+	}
+	info->GetIndexes().BindAndScan<BTree>(context, *info, [&](BTree &index) { return try_index_scan(index); });
 }
 
 string TableScanToString(const FunctionData *bind_data_p) {
@@ -437,6 +445,9 @@ TableFunction TableScanFunction::GetFunction() {
 	scan_function.projection_pushdown = true;
 	scan_function.filter_pushdown = true;
 	scan_function.filter_prune = true;
+	scan_function.row_id_filter_pushdown = true;
+	scan_function.in_filter_pushdown = true;
+	scan_function.dynamic_filter_pushdown = true;
 	scan_function.serialize = TableScanSerialize;
 	scan_function.deserialize = TableScanDeserialize;
 	return scan_function;
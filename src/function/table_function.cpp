@@ -19,7 +19,8 @@ TableFunction::TableFunction(string name, vector<LogicalType> arguments, table_f
       in_out_function_final(nullptr), statistics(nullptr), dependency(nullptr), cardinality(nullptr),
       pushdown_complex_filter(nullptr), to_string(nullptr), table_scan_progress(nullptr), get_batch_index(nullptr),
       get_bind_info(nullptr), type_pushdown(nullptr), get_multi_file_reader(nullptr), serialize(nullptr),
-      deserialize(nullptr), projection_pushdown(false), filter_pushdown(false), filter_prune(false) {
+      deserialize(nullptr), projection_pushdown(false), filter_pushdown(false), filter_prune(false),
+      row_id_filter_pushdown(false), in_filter_pushdown(false), dynamic_filter_pushdown(false) {
 }
 
 TableFunction::TableFunction(const vector<LogicalType> &arguments, table_function_t function,
@@ -33,7 +34,8 @@ TableFunction::TableFunction()
       cardinality(nullptr), pushdown_complex_filter(nullptr), to_string(nullptr), table_scan_progress(nullptr),
       get_batch_index(nullptr), get_bind_info(nullptr), type_pushdown(nullptr), get_multi_file_reader(nullptr),
       serialize(nullptr), deserialize(nullptr), projection_pushdown(false), filter_pushdown(false),
-      filter_prune(false) {
+      filter_prune(false), row_id_filter_pushdown(false), in_filter_pushdown(false),
+      dynamic_filter_pushdown(false) {
 }
 
 bool TableFunction::Equal(const TableFunction &rhs) const {
@@ -122,6 +122,8 @@ enum class DistinctType : uint8_t;
 
 enum class ErrorType : uint16_t;
 
+enum class EvictionPolicy : uint8_t;
+
 enum class ExceptionFormatValueType : uint8_t;
 
 enum class ExceptionType : uint8_t;
@@ -492,6 +494,9 @@ const char* EnumUtil::ToChars<DistinctType>(DistinctType value);
 template<>
 const char* EnumUtil::ToChars<ErrorType>(ErrorType value);
 
+template<>
+const char* EnumUtil::ToChars<EvictionPolicy>(EvictionPolicy value);
+
 template<>
 const char* EnumUtil::ToChars<ExceptionFormatValueType>(ExceptionFormatValueType value);
 
@@ -979,6 +984,9 @@ DistinctType EnumUtil::FromString<DistinctType>(const char *value);
 template<>
 ErrorType EnumUtil::FromString<ErrorType>(const char *value);
 
+template<>
+EvictionPolicy EnumUtil::FromString<EvictionPolicy>(const char *value);
+
 template<>
 ExceptionFormatValueType EnumUtil::FromString<ExceptionFormatValueType>(const char *value);
 
@@ -0,0 +1,23 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/eviction_policy.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The policy the buffer pool uses to pick which unpinned buffers of a FileBufferType to evict
+enum class EvictionPolicy : uint8_t {
+	//! Evict the least recently used buffers first
+	LRU = 0,
+	//! Scan-resistant 2Q: buffers that have only been used once are evicted before buffers that have been re-used
+	TWO_QUEUE = 1
+};
+
+} // namespace duckdb
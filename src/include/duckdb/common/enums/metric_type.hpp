@@ -30,6 +30,7 @@ enum class MetricsType : uint8_t {
     CUMULATIVE_ROWS_SCANNED,
     OPERATOR_ROWS_SCANNED,
     OPERATOR_TIMING,
+    TASK_TIME,
     ALL_OPTIMIZERS,
     CUMULATIVE_OPTIMIZER_TIMING,
     PLANNER,
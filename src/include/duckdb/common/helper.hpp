@@ -37,6 +37,15 @@ namespace duckdb {
 #define DUCKDB_EXPLICIT_FALLTHROUGH
 #endif
 
+// function multi-versioning: kernels marked with DUCKDB_TARGET_CLONES are compiled for several instruction sets,
+// the best version for the CPU is selected once when the library is loaded (through an ifunc resolver)
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 8 && defined(__x86_64__) && defined(__linux__) &&         \
+    defined(__GLIBC__) && !defined(__AVX2__) && !defined(DUCKDB_DISABLE_TARGET_CLONES)
+#define DUCKDB_TARGET_CLONES __attribute__((target_clones("arch=skylake-avx512", "avx2", "default")))
+#else
+#define DUCKDB_TARGET_CLONES
+#endif
+
 template <class... T>
 struct AlwaysFalse {
 	static constexpr bool VALUE = false;
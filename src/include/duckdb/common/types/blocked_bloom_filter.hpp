@@ -0,0 +1,105 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/types/blocked_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+class Serializer;
+class Deserializer;
+
+//! The BlockedBloomFilter is a register-blocked Bloom filter over hash values
+//! Every key sets (and checks) a small number of bits within a single 64-bit block, so that a lookup costs at most one
+//! cache miss and the probe loop can be executed without branches
+class BlockedBloomFilter {
+public:
+	//! The (minimum) number of bits we allocate per expected key
+	static constexpr const idx_t BITS_PER_KEY = 16;
+	//! The number of bits that are set in a block for every key
+	static constexpr const idx_t BITS_PER_HASH = 4;
+	//! The number of hash bits that are used to determine a bit within a block
+	static constexpr const idx_t BITS_PER_BIT_INDEX = 6;
+	//! The hash bits from which the block index is taken (the lower bits are used for the bit indices)
+	static constexpr const idx_t BLOCK_INDEX_SHIFT = BITS_PER_HASH * BITS_PER_BIT_INDEX;
+
+public:
+	//! Creates an empty Bloom filter, sized for "expected_count" keys
+	explicit BlockedBloomFilter(idx_t expected_count);
+	//! Creates a Bloom filter from previously constructed blocks, the number of blocks must be a power of two
+	explicit BlockedBloomFilter(vector<uint64_t> blocks);
+
+	//! Inserts a single hash into the Bloom filter
+	inline void Insert(hash_t hash) {
+		blocks[GetBlockIndex(hash)] |= GetBlockMask(hash);
+	}
+	//! Inserts the hashes of the (valid) rows in "sel" into the Bloom filter
+	void Insert(Vector &hashes, const SelectionVector &sel, idx_t count);
+	//! Inserts "count" hashes into the Bloom filter
+	void Insert(Vector &hashes, idx_t count);
+	//! Inserts "count" hashes into the Bloom filter, can be called by multiple threads concurrently
+	void InsertParallel(const hash_t hashes[], idx_t count);
+	//! Merges the bits of another Bloom filter with the same number of blocks into this Bloom filter
+	void Merge(const BlockedBloomFilter &other);
+
+	//! Returns false if the hash is definitely not contained in the Bloom filter
+	inline bool Lookup(hash_t hash) const {
+		const auto mask = GetBlockMask(hash);
+		return (blocks[GetBlockIndex(hash)] & mask) == mask;
+	}
+	//! Looks up the hashes of the rows in "sel", and writes the rows that could be contained in the filter to "result"
+	//! Returns the number of rows that were written to "result"
+	idx_t Lookup(Vector &hashes, const SelectionVector &sel, idx_t count, SelectionVector &result) const;
+
+	//! The number of 64-bit blocks in the Bloom filter
+	idx_t BlockCount() const {
+		return blocks.size();
+	}
+	//! The size of the Bloom filter in bytes
+	idx_t SizeInBytes() const {
+		return blocks.size() * sizeof(uint64_t);
+	}
+	const vector<uint64_t> &GetBlocks() const {
+		return blocks;
+	}
+
+	//! The size in bytes of a Bloom filter that is sized for "expected_count" keys
+	static idx_t RequiredSize(idx_t expected_count) {
+		return RequiredBlockCount(expected_count) * sizeof(uint64_t);
+	}
+
+	void Serialize(Serializer &serializer) const;
+	static shared_ptr<BlockedBloomFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	static idx_t RequiredBlockCount(idx_t expected_count) {
+		const auto required_bits = MaxValue<idx_t>(expected_count, 1) * BITS_PER_KEY;
+		return NextPowerOfTwo((required_bits + 63) / 64);
+	}
+	inline idx_t GetBlockIndex(hash_t hash) const {
+		return (hash >> BLOCK_INDEX_SHIFT) & bitmask;
+	}
+	static inline uint64_t GetBlockMask(hash_t hash) {
+		static constexpr const hash_t BIT_INDEX_MASK = (1ULL << BITS_PER_BIT_INDEX) - 1;
+		uint64_t mask = 0;
+		for (idx_t i = 0; i < BITS_PER_HASH; i++) {
+			mask |= 1ULL << ((hash >> (i * BITS_PER_BIT_INDEX)) & BIT_INDEX_MASK);
+		}
+		return mask;
+	}
+
+private:
+	//! The bit blocks of the Bloom filter
+	vector<uint64_t> blocks;
+	//! Bitmask to compute the block index (the number of blocks is always a power of two)
+	idx_t bitmask;
+};
+
+} // namespace duckdb
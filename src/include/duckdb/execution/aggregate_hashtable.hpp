@@ -89,6 +89,10 @@ public:
 	void SetRadixBits(idx_t radix_bits);
 	//! Initializes the PartitionedTupleData
 	void InitializePartitionedData();
+	//! Whether to append every row as a new group without probing the pointer table
+	void SetSkipLookups(bool skip_lookups_p);
+	//! Whether the HT appends rows without probing the pointer table
+	bool IsSkippingLookups() const;
 
 	//! Executes the filter(if any) and update the aggregates
 	void Combine(GroupedAggregateHashTable &other);
@@ -137,6 +141,8 @@ private:
 	idx_t hash_offset;
 	//! Bitmask for getting relevant bits from the hashes to determine the position
 	hash_t bitmask;
+	//! Whether the pointer table is bypassed, i.e., every row becomes a new group that is combined later
+	bool skip_lookups;
 
 	//! The active arena allocator used by the aggregates for their internal state
 	shared_ptr<ArenaAllocator> aggregate_allocator;
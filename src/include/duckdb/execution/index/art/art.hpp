@@ -66,10 +66,10 @@ public:
 
 public:
 	//! Try to initialize a scan on the ART with the given expression and filter.
-	unique_ptr<IndexScanState> TryInitializeScan(const Expression &expr, const Expression &filter_expr);
+	unique_ptr<IndexScanState> TryInitializeScan(const Expression &expr, const Expression &filter_expr) override;
 	//! Perform a lookup on the ART, fetching up to max_count row IDs.
 	//! If all row IDs were fetched, it return true, else false.
-	bool Scan(IndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids);
+	bool Scan(IndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids) override;
 
 	//! Append a chunk by first executing the ART's expressions.
 	ErrorData Append(IndexLock &lock, DataChunk &input, Vector &row_ids) override;
@@ -67,6 +67,13 @@ public:
 public: // Index interface
 	//! Obtain a lock on the index
 	void InitializeLock(IndexLock &state);
+
+	//! Try to initialize a scan on the index with the given expression and filter.
+	//! Returns nullptr, if the index cannot be used to evaluate the filter
+	virtual unique_ptr<IndexScanState> TryInitializeScan(const Expression &expr, const Expression &filter_expr);
+	//! Perform a lookup on the index, fetching up to max_count row IDs.
+	//! If all row IDs were fetched, it returns true, else false
+	virtual bool Scan(IndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids);
 	//! Called when data is appended to the index. The lock obtained from InitializeLock must be held
 	virtual ErrorData Append(IndexLock &state, DataChunk &entries, Vector &row_identifiers) = 0;
 	//! Obtains a lock and calls Append while holding that lock
@@ -139,6 +146,12 @@ protected:
 	//! Bound expressions used during expression execution
 	vector<unique_ptr<Expression>> bound_expressions;
 
+	//! Try to match the filter to a constant comparison or BETWEEN on the indexed expression, and set the scan
+	//! predicates: a single predicate for point lookups and one-sided ranges, and two predicates for range scans.
+	//! Returns false, if the index cannot be used to evaluate the filter
+	static bool TryGetScanPredicates(const Expression &expr, const Expression &filter_expr, Value (&values)[2],
+	                                 ExpressionType (&expressions)[2]);
+
 private:
 	//! Expression executor to execute the index expressions
 	ExpressionExecutor executor;
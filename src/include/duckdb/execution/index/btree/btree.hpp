@@ -0,0 +1,143 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/index/btree/btree.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/index/bound_index.hpp"
+#include "duckdb/execution/index/fixed_size_allocator.hpp"
+
+namespace duckdb {
+
+struct BTreeNode;
+
+//! The BTree is a B+-tree over fixed-size keys. Its leaves hold sorted (key, row ID) entries, and its inner nodes
+//! hold separator entries and child pointers. Keys and row IDs use the byte-comparable encoding of the ART keys,
+//! so that entries compare with memcmp. All nodes are fixed-size segments of a FixedSizeAllocator, which serializes
+//! them block-wise. After loading or checkpointing, buffers are only read from disk when a lookup reaches them.
+//! Like the ART's, these buffers are not evicted by the buffer manager once they are in memory, and rebuilding or
+//! merging the tree materializes all of its nodes. The B+-tree must therefore fit in memory.
+class BTree : public BoundIndex {
+public:
+	//! Index type name for the B+-tree.
+	static constexpr const char *TYPE_NAME = "BTREE";
+	//! The size of a node in bytes.
+	static constexpr idx_t NODE_SIZE = 4096;
+	//! The minimum number of entries in a node.
+	static constexpr idx_t MIN_NODE_CAPACITY = 4;
+
+public:
+	BTree(const string &name, const IndexConstraintType index_constraint_type, const vector<column_t> &column_ids,
+	      TableIOManager &table_io_manager, const vector<unique_ptr<Expression>> &unbound_expressions,
+	      AttachedDatabase &db, const IndexStorageInfo &info = IndexStorageInfo());
+
+	//! Create a index instance of this type.
+	static unique_ptr<BoundIndex> Create(CreateIndexInput &input) {
+		auto btree = make_uniq<BTree>(input.name, input.constraint_type, input.column_ids, input.table_io_manager,
+		                              input.unbound_expressions, input.db, input.storage_info);
+		return std::move(btree);
+	}
+
+	//! Root of the tree.
+	IndexPointer root;
+	//! Fixed-size allocator holding the nodes.
+	unique_ptr<FixedSizeAllocator> allocator;
+	//! The size of an encoded key.
+	idx_t key_size;
+	//! The size of an entry, i.e., an encoded key followed by an encoded row ID.
+	idx_t entry_size;
+	//! The maximum number of entries in a leaf.
+	idx_t leaf_capacity;
+	//! The maximum number of separators in an inner node.
+	idx_t inner_capacity;
+
+public:
+	//! Try to initialize a scan on the B+-tree with the given expression and filter.
+	unique_ptr<IndexScanState> TryInitializeScan(const Expression &expr, const Expression &filter_expr) override;
+	//! Perform a lookup on the B+-tree, fetching up to max_count row IDs.
+	//! If all row IDs were fetched, it return true, else false.
+	bool Scan(IndexScanState &state, idx_t max_count, unsafe_vector<row_t> &row_ids) override;
+
+	//! Append a chunk by first executing the B+-tree's expressions.
+	ErrorData Append(IndexLock &lock, DataChunk &input, Vector &row_ids) override;
+	//! Insert a chunk.
+	ErrorData Insert(IndexLock &lock, DataChunk &data, Vector &row_ids) override;
+
+	//! The B+-tree does not enforce constraints.
+	void VerifyAppend(DataChunk &chunk) override;
+	void VerifyAppend(DataChunk &chunk, ConflictManager &conflict_manager) override;
+
+	//! Delete a chunk from the B+-tree.
+	void Delete(IndexLock &lock, DataChunk &entries, Vector &row_ids) override;
+	//! Drop the B+-tree.
+	void CommitDrop(IndexLock &index_lock) override;
+
+	//! Merge another B+-tree into this B+-tree. Both must be locked.
+	bool MergeIndexes(IndexLock &state, BoundIndex &other_index) override;
+	//! Merge other B+-trees into this B+-tree, building the merged tree bottom-up once. All must be locked.
+	void MergeIndexes(IndexLock &state, const vector<reference<BTree>> &other_indexes);
+	//! Rebuilds the B+-tree, if its allocator is fragmented.
+	void Vacuum(IndexLock &state) override;
+
+	//! Returns B+-tree storage serialization information.
+	IndexStorageInfo GetStorageInfo(const case_insensitive_map_t<Value> &options, const bool to_wal) override;
+	//! Returns the in-memory usage of the B+-tree.
+	idx_t GetInMemorySize(IndexLock &index_lock) override;
+
+	//! Verifies the order of the entries and returns a string of the B+-tree.
+	string VerifyAndToString(IndexLock &state, const bool only_verify) override;
+	//! Verifies that the node allocations match the node count.
+	void VerifyAllocations(IndexLock &state) override;
+
+	//! Node accessors.
+	IndexPointer NewNode(const bool leaf);
+	BTreeNode &GetNode(const IndexPointer ptr, const bool dirty = true);
+	data_ptr_t GetEntries(BTreeNode &node);
+	IndexPointer *GetChildren(BTreeNode &node);
+	data_ptr_t GetSeparators(BTreeNode &node);
+	//! Returns the leftmost leaf of the tree.
+	IndexPointer GetFirstLeaf();
+
+private:
+	//! Descends to the leaf that holds the entry, and records the path.
+	void FindLeaf(const_data_ptr_t entry);
+	//! Inserts an entry, if it does not exist yet.
+	void InsertEntry(const_data_ptr_t entry);
+	//! Inserts a separator and its right child into the inner nodes on the path, starting at the parent of the
+	//! last node on the path.
+	void InsertSeparator(data_ptr_t separator, IndexPointer child);
+	//! Deletes an entry, if it exists.
+	void DeleteEntry(const_data_ptr_t entry);
+	//! Removes the (empty) last node of the path from the tree.
+	void RemoveNode();
+	//! Collapses inner roots with a single child.
+	void CollapseRoot();
+
+	//! Encodes the keys and row IDs of a chunk into entries.
+	idx_t GenerateEntries(DataChunk &input, Vector &row_ids, unsafe_vector<data_t> &entries);
+	//! Replaces the tree with a compact copy of itself, merged with the entries of the other trees (if any).
+	//! The copy is built in memory next to the existing trees, so that the peak memory usage is twice their size.
+	void Rebuild(const vector<reference<BTree>> &others);
+	//! Writes the node buffers to disk.
+	void WritePartialBlocks();
+
+	//! Traverses all nodes, and returns the node count.
+	idx_t CountNodes(const IndexPointer ptr);
+	void VerifyAllocationsInternal();
+
+	string GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index,
+	                                     DataChunk &input) override;
+	void CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) override;
+
+private:
+	//! The path of the last descent, i.e., the nodes and the positions of their children.
+	unsafe_vector<pair<IndexPointer, idx_t>> path;
+	//! Scratch space for separators propagated during node splits.
+	unsafe_vector<data_t> separator_buffer;
+};
+
+} // namespace duckdb
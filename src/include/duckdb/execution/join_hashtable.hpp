@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
 #include "duckdb/common/types/column/column_data_consumer.hpp"
 #include "duckdb/common/types/column/partitioned_column_data.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
@@ -62,6 +63,13 @@ public:
 	//! only compare salts with the ht entries if the capacity is larger than 8192 so
 	//! that it does not fit into the CPU cache
 	static constexpr const idx_t USE_SALT_THRESHOLD = 8192;
+	//! only build a Bloom filter if the pointer table has at least this capacity (1MB), so that checking the much
+	//! smaller Bloom filter saves us cache misses in the pointer table
+	static constexpr const idx_t BLOOM_FILTER_THRESHOLD = 131072;
+	//! the number of probed keys after which a probe state decides whether checking the Bloom filter pays off
+	static constexpr const idx_t BLOOM_FILTER_SAMPLE_COUNT = 8 * STANDARD_VECTOR_SIZE;
+	//! the Bloom filter is disabled for a probe state if more than this percentage of the sampled keys passed it
+	static constexpr const idx_t BLOOM_FILTER_MAX_PASS_PERCENTAGE = 50;
 
 	//! Scan structure that can be used to resume scans, as a single probe can
 	//! return 1024*N values (where N is the size of the HT). This is
@@ -145,6 +153,14 @@ public:
 		Vector ht_offsets_dense_v;
 
 		SelectionVector non_empty_sel;
+
+		//! Keys that passed the Bloom filter
+		SelectionVector bloom_filter_sel;
+		//! Whether or not to check the Bloom filter (if any) before probing the pointer table
+		bool use_bloom_filter;
+		//! The number of keys that were checked against the Bloom filter, and the number of keys that passed it
+		idx_t bloom_filter_probe_count;
+		idx_t bloom_filter_pass_count;
 	};
 
 	struct InsertState : SharedState {
@@ -281,6 +297,8 @@ private:
 	void Hash(DataChunk &keys, const SelectionVector &sel, idx_t count, Vector &hashes);
 
 	bool UseSalt() const;
+	//! Removes the keys from "current_sel" whose hashes are definitely not in the HT, if the Bloom filter is enabled
+	void ApplyBloomFilter(ProbeState &state, Vector &hashes_v, const SelectionVector *&current_sel, idx_t &count);
 
 	//! Gets a pointer to the entry in the HT for each of the hashes_v using linear probing. Will update the
 	//! key_match_sel vector and the count argument to the number and position of the matches
@@ -306,6 +324,8 @@ private:
 	//! The hash map of the HT, created after finalization
 	AllocatedData hash_map;
 	ht_entry_t *entries = nullptr;
+	//! Bloom filter over the hashes in the HT, created after finalization if the pointer table is large
+	unique_ptr<BlockedBloomFilter> bloom_filter;
 	//! Whether or not NULL values are considered equal in each of the comparisons
 	vector<bool> null_values_are_equal;
 	//! An empty tuple that's a "dead end", can be used to stop chains early
@@ -384,9 +404,17 @@ public:
 	static idx_t PointerTableCapacity(idx_t count) {
 		return MaxValue<idx_t>(NextPowerOfTwo(count * 2), 1 << 10);
 	}
-	//! Size of the pointer table (in bytes)
+	//! Whether or not a Bloom filter is built for a HT with the given count
+	static bool UseBloomFilter(idx_t count) {
+		return PointerTableCapacity(count) >= BLOOM_FILTER_THRESHOLD;
+	}
+	//! Size of the pointer table (in bytes), including the Bloom filter
 	static idx_t PointerTableSize(idx_t count) {
-		return PointerTableCapacity(count) * sizeof(data_ptr_t);
+		auto size = PointerTableCapacity(count) * sizeof(data_ptr_t);
+		if (UseBloomFilter(count)) {
+			size += BlockedBloomFilter::RequiredSize(count);
+		}
+		return size;
 	}
 
 	//! Get total size of HT if all partitions would be built
@@ -396,6 +424,8 @@ public:
 	                   idx_t &max_partition_size, idx_t &max_partition_count) const;
 	//! Get the remaining size of the unbuilt partitions
 	idx_t GetRemainingSize() const;
+	//! Sets the number of radix bits the build side is partitioned with (before any data was sunk)
+	void SetInitialRadixBits(const idx_t radix_bits);
 	//! Sets number of radix bits according to the max ht size
 	void SetRepartitionRadixBits(const idx_t max_ht_size, const idx_t max_partition_size,
 	                             const idx_t max_partition_count);
@@ -411,11 +441,24 @@ public:
 	                   ProbeState &probe_state, DataChunk &payload, ProbeSpill &probe_spill,
 	                   ProbeSpillLocalAppendState &spill_state, DataChunk &spill_chunk);
 
+private:
+	//! Determine the order in which the partitions are built, and the partitions of the current probe round
+	void InitializePartitionOrder();
+	//! Select the hashes that belong to a partition of the current probe round
+	idx_t SelectCurrentPartitions(Vector &hashes, const idx_t count, SelectionVector &true_sel,
+	                              SelectionVector &false_sel) const;
+
 private:
 	//! The current number of radix bits used to partition
 	idx_t radix_bits;
 
-	//! First and last partition of the current probe round
+	//! The order in which the partitions are built, from small to large
+	//! The first round (probed while streaming the probe side) covers as many partitions as possible this way,
+	//! and partitions that are empty on the build side never spill any probe data
+	vector<idx_t> partition_order;
+	//! Whether a partition is built in the current probe round
+	unsafe_unique_array<bool> current_partitions;
+	//! First and last position in the partition order of the current probe round
 	idx_t partition_start;
 	idx_t partition_end;
 };
@@ -146,6 +146,38 @@ protected:
 		return (v - UINT64_C(0x0101010101010101)) & ~(v)&UINT64_C(0x8080808080808080);
 	}
 
+	//! Skips ahead in the buffer until the first word that can contain a byte for which "op" (applied to a word of 8
+	//! bytes) produces a zero byte. Blocks of 32 bytes are classified at once: the four words are combined into a
+	//! single mask, so a single branch is taken for every block without special characters.
+	//! The caller resolves the exact position of the special character with the skip tables of the state machine.
+	template <class OP>
+	inline void SkipToSpecialCharacter(const idx_t to_pos, OP &&op) {
+		static constexpr idx_t WORD_SIZE = sizeof(uint64_t);
+		static constexpr idx_t BLOCK_SIZE = 4 * WORD_SIZE;
+		const auto buffer_ptr = reinterpret_cast<const_data_ptr_t>(buffer_handle_ptr);
+		auto &pos = iterator.pos.buffer_pos;
+		while (pos + BLOCK_SIZE < to_pos) {
+			auto ptr = buffer_ptr + pos;
+			const bool match_0 = ContainsZeroByte(op(Load<uint64_t>(ptr)));
+			const bool match_1 = ContainsZeroByte(op(Load<uint64_t>(ptr + WORD_SIZE)));
+			const bool match_2 = ContainsZeroByte(op(Load<uint64_t>(ptr + 2 * WORD_SIZE)));
+			const bool match_3 = ContainsZeroByte(op(Load<uint64_t>(ptr + 3 * WORD_SIZE)));
+			if (!(match_0 | match_1 | match_2 | match_3)) {
+				pos += BLOCK_SIZE;
+				continue;
+			}
+			// jump to the first word that contains a special character
+			pos += match_0 ? 0 : match_1 ? WORD_SIZE : match_2 ? 2 * WORD_SIZE : 3 * WORD_SIZE;
+			return;
+		}
+		while (pos + WORD_SIZE < to_pos) {
+			if (ContainsZeroByte(op(Load<uint64_t>(buffer_ptr + pos)))) {
+				return;
+			}
+			pos += WORD_SIZE;
+		}
+	}
+
 	//! Process one chunk
 	template <class T>
 	void Process(T &result) {
@@ -236,15 +268,10 @@ protected:
 				ever_quoted = true;
 				T::SetQuoted(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.quote) &
-					                     (value ^ state_machine->transition_array.escape))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
-				}
+				SkipToSpecialCharacter(to_pos, [&](uint64_t value) {
+					return (value ^ state_machine->transition_array.quote) &
+					       (value ^ state_machine->transition_array.escape);
+				});
 
 				while (state_machine->transition_array
 				           .skip_quoted[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
@@ -258,17 +285,12 @@ protected:
 				break;
 			case CSVState::STANDARD: {
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.delimiter) &
-					                     (value ^ state_machine->transition_array.new_line) &
-					                     (value ^ state_machine->transition_array.carriage_return) &
-					                     (value ^ state_machine->transition_array.comment))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
-				}
+				SkipToSpecialCharacter(to_pos, [&](uint64_t value) {
+					return (value ^ state_machine->transition_array.delimiter) &
+					       (value ^ state_machine->transition_array.new_line) &
+					       (value ^ state_machine->transition_array.carriage_return) &
+					       (value ^ state_machine->transition_array.comment);
+				});
 				while (state_machine->transition_array
 				           .skip_standard[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
 				       iterator.pos.buffer_pos < to_pos - 1) {
@@ -283,15 +305,10 @@ protected:
 			case CSVState::COMMENT: {
 				T::SetComment(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.new_line) &
-					                     (value ^ state_machine->transition_array.carriage_return))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
-				}
+				SkipToSpecialCharacter(to_pos, [&](uint64_t value) {
+					return (value ^ state_machine->transition_array.new_line) &
+					       (value ^ state_machine->transition_array.carriage_return);
+				});
 				while (state_machine->transition_array
 				           .skip_comment[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
 				       iterator.pos.buffer_pos < to_pos - 1) {
@@ -15,6 +15,7 @@
 namespace duckdb {
 class DataChunk;
 class DynamicTableFilterSet;
+class JoinHashTable;
 struct GlobalUngroupedAggregateState;
 struct LocalUngroupedAggregateState;
 
@@ -46,6 +47,13 @@ struct JoinFilterPushdownInfo {
 	vector<JoinFilterPushdownColumn> filters;
 	//! Min/Max aggregates
 	vector<unique_ptr<Expression>> min_max_aggregates;
+	//! Whether the probe side can apply IN filters
+	bool in_filter_pushdown = false;
+
+	//! The maximum build-side size for which we push the exact set of keys as an IN filter
+	static constexpr const idx_t IN_FILTER_MAX_BUILD_SIZE = 64;
+	//! The maximum build-side size for which we construct Bloom filters
+	static constexpr const idx_t BLOOM_FILTER_MAX_BUILD_SIZE = 4194304;
 
 public:
 	unique_ptr<JoinFilterGlobalState> GetGlobalState(ClientContext &context, const PhysicalOperator &op) const;
@@ -53,7 +61,13 @@ public:
 
 	void Sink(DataChunk &chunk, JoinFilterLocalState &lstate) const;
 	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
-	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+	void PushFilters(JoinFilterGlobalState &gstate, JoinHashTable &ht, const PhysicalOperator &op) const;
+
+private:
+	//! Collects the distinct build-side keys of the given filters, and pushes them into the probe side as IN filters
+	void PushInFilters(JoinHashTable &ht, const PhysicalOperator &op, const vector<idx_t> &filter_idxs) const;
+	//! Builds a Bloom filter over the build-side keys of the given filters, and pushes them into the probe side
+	void PushBloomFilters(JoinHashTable &ht, const PhysicalOperator &op, const vector<idx_t> &filter_idxs) const;
 };
 
 } // namespace duckdb
@@ -12,6 +12,7 @@
 #include "duckdb/planner/bound_query_node.hpp"
 
 namespace duckdb {
+struct DynamicFilterData;
 
 //! Represents a physical ordering of the data. Note that this will not change
 //! the data but only add a selection vector.
@@ -21,11 +22,14 @@ public:
 
 public:
 	PhysicalTopN(vector<LogicalType> types, vector<BoundOrderByNode> orders, idx_t limit, idx_t offset,
-	             idx_t estimated_cardinality);
+	             shared_ptr<DynamicFilterData> dynamic_filter, idx_t estimated_cardinality);
 
 	vector<BoundOrderByNode> orders;
 	idx_t limit;
 	idx_t offset;
+	//! The filter on the first order that is pushed into the scan (if any)
+	//! It is set to the boundary of the Top N as soon as the Top N has been filled
+	shared_ptr<DynamicFilterData> dynamic_filter;
 
 public:
 	// Source interface
@@ -28,6 +28,7 @@ struct ColumnFetchState;
 struct ColumnScanState;
 struct PrefetchState;
 struct SegmentScanState;
+class TableFilter;
 
 class CompressionInfo {
 public:
@@ -169,6 +170,14 @@ typedef void (*compression_fetch_row_t)(ColumnSegment &segment, ColumnFetchState
 //! Function prototype used for skipping 'skip_count' values, non-trivial if random-access is not supported for the
 //! compressed data.
 typedef void (*compression_skip_t)(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count);
+//! Function prototype used for reading an entire vector and applying a filter to the values (optional). The filter is
+//! evaluated on the compressed representation where possible (e.g. once per run or dictionary entry).
+//! "sel" holds the "sel_count" rows that passed the previous filters, and is refined to the rows that pass the filter.
+//! The filter is only called with filters that depend solely on the value of a row - NULL values are handled by the
+//! caller.
+typedef void (*compression_filter_t)(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count,
+                                     Vector &result, SelectionVector &sel, idx_t &sel_count,
+                                     const TableFilter &filter);
 
 //===--------------------------------------------------------------------===//
 // Append (optional)
@@ -206,13 +215,13 @@ public:
 	                    compression_serialize_state_t serialize_state = nullptr,
 	                    compression_deserialize_state_t deserialize_state = nullptr,
 	                    compression_cleanup_state_t cleanup_state = nullptr,
-	                    compression_init_prefetch_t init_prefetch = nullptr)
+	                    compression_init_prefetch_t init_prefetch = nullptr, compression_filter_t filter = nullptr)
 	    : type(type), data_type(data_type), init_analyze(init_analyze), analyze(analyze), final_analyze(final_analyze),
 	      init_compression(init_compression), compress(compress), compress_finalize(compress_finalize),
 	      init_prefetch(init_prefetch), init_scan(init_scan), scan_vector(scan_vector), scan_partial(scan_partial),
-	      fetch_row(fetch_row), skip(skip), init_segment(init_segment), init_append(init_append), append(append),
-	      finalize_append(finalize_append), revert_append(revert_append), serialize_state(serialize_state),
-	      deserialize_state(deserialize_state), cleanup_state(cleanup_state) {
+	      fetch_row(fetch_row), skip(skip), filter(filter), init_segment(init_segment), init_append(init_append),
+	      append(append), finalize_append(finalize_append), revert_append(revert_append),
+	      serialize_state(serialize_state), deserialize_state(deserialize_state), cleanup_state(cleanup_state) {
 	}
 
 	//! Compression type
@@ -256,6 +265,8 @@ public:
 	compression_fetch_row_t fetch_row;
 	//! Skip forward in the compressed segment
 	compression_skip_t skip;
+	//! Scan an entire vector and apply a filter directly on the compressed data (optional)
+	compression_filter_t filter;
 
 	// Append functions
 	//! This only really needs to be defined for uncompressed segments
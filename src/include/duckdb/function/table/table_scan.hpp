@@ -31,6 +31,13 @@ struct TableScanBindData : public TableFunctionData {
 	unsafe_vector<row_t> row_ids;
 
 public:
+	unique_ptr<FunctionData> Copy() const override {
+		auto bind_data = make_uniq<TableScanBindData>(table);
+		bind_data->is_index_scan = is_index_scan;
+		bind_data->is_create_index = is_create_index;
+		bind_data->row_ids = row_ids;
+		return std::move(bind_data);
+	}
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = other_p.Cast<TableScanBindData>();
 		return &other.table == &table && row_ids == other.row_ids;
@@ -294,6 +294,14 @@ public:
 	//! Whether or not the table function can immediately prune out filter columns that are unused in the remainder of
 	//! the query plan, e.g., "SELECT i FROM tbl WHERE j = 42;" - j does not need to leave the table function at all
 	bool filter_prune;
+	//! Whether or not the table function can apply filters on the row id column (requires filter_pushdown)
+	bool row_id_filter_pushdown;
+	//! Whether or not the table function can apply IN filters (requires filter_pushdown). If not supported, IN lists
+	//! are applied in a filter on top of the table function
+	bool in_filter_pushdown;
+	//! Whether or not the table function can apply dynamic filters, whose boundary is updated during execution
+	//! (requires filter_pushdown)
+	bool dynamic_filter_pushdown;
 	//! Additional function info, passed to the bind
 	shared_ptr<TableFunctionInfo> function_info;
 
@@ -91,6 +91,36 @@ struct CheckpointThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct CheckpointOnWALReplaySetting {
+	static constexpr const char *Name = "checkpoint_on_wal_replay";
+	static constexpr const char *Description =
+	    "Whether or not to checkpoint a database right after its WAL has been replayed when it is loaded";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WALGroupCommitSetting {
+	static constexpr const char *Name = "wal_group_commit";
+	static constexpr const char *Description =
+	    "Whether or not concurrent commits are made durable together with a single sync of the WAL";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WALGroupCommitDelaySetting {
+	static constexpr const char *Name = "wal_group_commit_delay";
+	static constexpr const char *Description =
+	    "The time (in microseconds) a group commit waits for other commits to join before syncing the WAL";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DebugCheckpointAbort {
 	static constexpr const char *Name = "debug_checkpoint_abort";
 	static constexpr const char *Description =
@@ -405,6 +435,17 @@ struct EnableProgressBarPrintSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EvictionPolicySetting {
+	static constexpr const char *Name = "eviction_policy";
+	static constexpr const char *Description =
+	    "The policy used to evict buffers, either for all buffer types (e.g. '2Q') or per buffer type (e.g. "
+	    "'BLOCK=2Q, MANAGED_BUFFER=LRU'). Supported policies are LRU and 2Q (scan-resistant)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ErrorsAsJsonSetting {
 	static constexpr const char *Name = "errors_as_json";
 	static constexpr const char *Description = "Output error messages as structured JSON instead of as a raw string";
@@ -536,6 +577,16 @@ struct ImmediateTransactionModeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct IncrementalCheckpointSetting {
+	static constexpr const char *Name = "incremental_checkpoint";
+	static constexpr const char *Description =
+	    "Whether checkpoints only rewrite the changed and appended segments of a column, instead of the entire column";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct MaximumExpressionDepthSetting {
 	static constexpr const char *Name = "max_expression_depth";
 	static constexpr const char *Description =
@@ -773,6 +824,18 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct QueryPrioritySetting {
+	static constexpr const char *Name = "query_priority";
+	static constexpr const char *Description =
+	    "Sets the scheduling weight (1-100) of the queries of this connection: when multiple queries run concurrently, "
+	    "the threads are shared in proportion to their weights";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static constexpr const idx_t MAX_PRIORITY = 100;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ScalarSubqueryErrorOnMultipleRows {
 	static constexpr const char *Name = "scalar_subquery_error_on_multiple_rows";
 	static constexpr const char *Description =
@@ -783,6 +846,16 @@ struct ScalarSubqueryErrorOnMultipleRows {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ScanPrefetchDepthSetting {
+	static constexpr const char *Name = "scan_prefetch_depth";
+	static constexpr const char *Description =
+	    "The number of vectors table scans read ahead from disk using batched reads (0 to disable)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct SchemaSetting {
 	static constexpr const char *Name = "schema";
 	static constexpr const char *Description =
@@ -821,6 +894,16 @@ struct TempDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "Whether or not to compress buffers that are offloaded to the temporary directory using LZ4";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
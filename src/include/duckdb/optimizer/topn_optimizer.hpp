@@ -14,12 +14,32 @@ namespace duckdb {
 class LogicalOperator;
 class Optimizer;
 
+class LogicalTopN;
+
 class TopN {
 public:
+	explicit TopN(Optimizer &optimizer);
+
 	//! Optimize ORDER BY + LIMIT to TopN
 	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
 	//! Whether we can perform the optimization on this operator
 	static bool CanOptimize(LogicalOperator &op);
+
+	//! The maximum number of rows (LIMIT + OFFSET) for which we perform late materialization
+	static constexpr const idx_t LATE_MATERIALIZATION_MAX_ROWS = 128;
+	//! The minimum (estimated) cardinality of the scanned table for which we perform late materialization
+	static constexpr const idx_t LATE_MATERIALIZATION_MIN_CARDINALITY = 65536;
+
+private:
+	//! Late materialization: if the TopN reads from a table scan, only sort the ordering columns and the row ids of
+	//! the table, and fetch the remaining columns for the rows that survive the TopN using a semi-join on the row id
+	bool TryLateMaterialization(LogicalTopN &topn);
+	//! Push a filter on the first order into the table scan below the TopN, which is set to the boundary of the TopN
+	//! while it is computed, so the scan can skip row groups that cannot make it into the result anymore
+	void PushDynamicFilter(LogicalTopN &topn);
+
+private:
+	Optimizer &optimizer;
 };
 
 } // namespace duckdb
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 
 namespace duckdb {
 class ClientContext;
@@ -16,6 +17,7 @@ class Executor;
 class Task;
 class DatabaseInstance;
 struct ProducerToken;
+struct ProducerStatistics;
 
 enum class TaskExecutionMode : uint8_t { PROCESS_ALL, PROCESS_PARTIAL };
 
@@ -50,6 +52,10 @@ public:
 	virtual bool TaskBlockedOnResult() const {
 		return false;
 	}
+
+public:
+	//! The statistics of the producer that scheduled this task, set by the TaskScheduler
+	shared_ptr<ProducerStatistics> producer_statistics;
 };
 
 } // namespace duckdb
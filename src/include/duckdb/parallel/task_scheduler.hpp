@@ -11,6 +11,7 @@
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/reference_map.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/parallel/task.hpp"
 
@@ -23,6 +24,45 @@ class DatabaseInstance;
 class TaskScheduler;
 
 struct SchedulerThread;
+struct LocalTaskQueue;
+
+//! Counters of one of the task queues of the TaskScheduler
+struct TaskQueueInformation {
+	//! The index of the CPU-local queue, or DConstants::INVALID_INDEX for the shared queue
+	idx_t queue_idx;
+	//! The number of tasks that are currently in the queue
+	idx_t queued_tasks;
+	//! The total number of tasks that were scheduled in the queue
+	idx_t scheduled_tasks;
+	//! The total number of tasks that were taken from the queue by a thread running on the CPU of the queue
+	idx_t local_tasks;
+	//! The total number of tasks that were stolen from the queue by a thread running on another CPU
+	idx_t stolen_tasks;
+	//! The total time (in microseconds) that worker threads running on the CPU of the queue were waiting for tasks
+	idx_t idle_time_us;
+};
+
+//! The scheduling statistics of a producer
+//! The tasks of the producer share these, since a task can still be running after its producer has been destroyed
+struct ProducerStatistics {
+	ProducerStatistics() : priority(1), queued_tasks(0), task_time_us(0), virtual_time_us(0) {
+	}
+
+	//! The scheduling weight of the tasks of this producer (see the "query_priority" setting)
+	atomic<idx_t> priority;
+	//! The number of tasks of this producer that are currently queued
+	atomic<idx_t> queued_tasks;
+	//! The total time (in microseconds) that was spent executing the tasks of this producer
+	atomic<idx_t> task_time_us;
+	//! The task time divided by the priority - if multiple producers have queued tasks, the one with the lowest
+	//! virtual time is served first
+	atomic<idx_t> virtual_time_us;
+
+	void AddTaskTime(idx_t time_us) {
+		task_time_us += time_us;
+		virtual_time_us += time_us / MaxValue<idx_t>(priority, 1);
+	}
+};
 
 struct ProducerToken {
 	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
@@ -31,12 +71,23 @@ struct ProducerToken {
 	TaskScheduler &scheduler;
 	unique_ptr<QueueProducerToken> token;
 	mutex producer_lock;
+	//! The scheduling statistics of this producer
+	shared_ptr<ProducerStatistics> statistics;
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
+//! Tasks that are scheduled while background threads are running are placed in the queue of the CPU that scheduled
+//! them, so that the tasks of a pipeline are likely to be executed on the same CPU. Threads first take tasks from the
+//! queue of their own CPU, then from the shared queue, and finally steal tasks from the queues of other CPUs.
 class TaskScheduler {
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
+	// maximum number of CPU-local task queues
+	constexpr static idx_t MAX_LOCAL_QUEUES = 256;
+	// the virtual time (in microseconds) a producer can get ahead of the others before the producers are rebalanced
+	constexpr static idx_t FAIR_SHARE_SLACK_USECS = 5000;
+	// how often (in dequeued tasks) the fair share is recomputed while the producers are rebalanced
+	constexpr static idx_t REBALANCE_INTERVAL = 64;
 
 public:
 	explicit TaskScheduler(DatabaseInstance &db);
@@ -46,10 +97,14 @@ public:
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
 	unique_ptr<ProducerToken> CreateProducer();
+	//! Removes a producer from the set of producers, called when the producer is destroyed
+	void UnregisterProducer(ProducerToken &token);
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
 	bool GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	//! Executes a task, and adds the time spent to the producer that scheduled the task
+	static TaskExecutionResult ExecuteTask(Task &task, TaskExecutionMode mode);
 	//! Run tasks forever until "marker" is set to false, "marker" must remain valid until the thread is joined
 	void ExecuteForever(atomic<bool> *marker);
 	//! Run tasks until `marker` is set to false, `max_tasks` have been completed, or until there are no more tasks
@@ -84,13 +139,43 @@ public:
 	//! Result do not need to be exact 'return 0' is a valid fallback strategy
 	static idx_t GetEstimatedCPUId();
 
+	//! Returns the counters of the shared task queue and all CPU-local task queues
+	vector<TaskQueueInformation> GetTaskQueueInformation();
+
 private:
 	void RelaunchThreadsInternal(int32_t n);
+	//! Fetches a task from the local queue of the current CPU, the shared queue, or another local queue
+	bool DequeueTask(shared_ptr<Task> &task);
+	//! Fetches a task of a producer that is not ahead of the others, if multiple producers have queued tasks
+	//! The local queues are searched for such a task without taking the producer lock. Periodically, or if no such
+	//! task is found, the lowest virtual time of the producers is recomputed under the producer lock (if available).
+	bool DequeueFairShare(shared_ptr<Task> &task);
+	//! Marks a task as taken from one of the queues
+	void TaskDequeued(Task &task);
+
+	//! The local queue of the CPU the calling thread is running on
+	LocalTaskQueue &GetLocalQueue();
 
 private:
 	DatabaseInstance &db;
-	//! The task queue
+	//! The shared task queue
 	unique_ptr<ConcurrentQueue> queue;
+	//! The CPU-local task queues
+	vector<unique_ptr<LocalTaskQueue>> local_queues;
+	//! The number of background threads that are currently running
+	atomic<idx_t> background_thread_count;
+	//! Lock for the set of producers
+	mutex producer_lock;
+	//! All producers, used to balance the tasks of different queries
+	reference_set_t<ProducerToken> producers;
+	//! The number of producers that have queued tasks
+	atomic<idx_t> active_producer_count;
+	//! The virtual time of the most recently served producer, new producers start at this time
+	atomic<idx_t> min_virtual_time_us;
+	//! Whether a producer got ahead of the others - threads then serve the producers by virtual time
+	atomic<bool> rebalance_producers;
+	//! The number of tasks that were dequeued while rebalancing
+	atomic<idx_t> rebalance_counter;
 	//! Lock for modifying the thread count
 	mutex thread_lock;
 	//! The active background threads of the task scheduler
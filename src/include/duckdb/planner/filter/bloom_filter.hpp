@@ -0,0 +1,44 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+
+namespace duckdb {
+
+//! The BloomFilter is an approximate set-membership filter on the hashes of a column
+//! It has no false negatives: rows that are filtered out can never match, but rows that pass can still be misses
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+
+public:
+	BloomFilter(LogicalType key_type, shared_ptr<BlockedBloomFilter> filter);
+
+	//! The type of the keys that were hashed into the Bloom filter
+	LogicalType key_type;
+	//! The Bloom filter (shared between copies of this filter)
+	shared_ptr<BlockedBloomFilter> filter;
+
+public:
+	//! Filters the rows in "sel" whose value in "input" is definitely not in the Bloom filter (or NULL)
+	idx_t Filter(Vector &input, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -0,0 +1,55 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+
+namespace duckdb {
+
+//! The state of a DynamicFilter that is shared between the operator that produces it and the scans that use it
+//! The filter can only become more selective while it is being used: rows that are rejected stay rejected
+struct DynamicFilterData {
+	mutex lock;
+	//! The current comparison (if any)
+	unique_ptr<ConstantFilter> filter;
+	//! Whether or not the filter has been set
+	bool initialized = false;
+
+	//! Replace the comparison
+	void SetValue(ExpressionType comparison_type, Value constant);
+	//! Clear the comparison, e.g. before a (cached) plan is executed again
+	void Reset();
+};
+
+//! The DynamicFilter is a comparison with a constant that is set (and tightened) while the query is running
+//! e.g. the boundary of a Top N: values that cannot make it into the Top N anymore can be skipped by the scan
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	DynamicFilter();
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared state of the filter
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
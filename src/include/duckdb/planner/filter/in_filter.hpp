@@ -0,0 +1,48 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/in_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+class InFilterLookup;
+
+//! The InFilter checks whether a column is equal to one of a set of constants (i.e. "x IN (C1, C2, ...)")
+class InFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::IN_FILTER;
+	//! Up to this number of values we use binary search over a sorted array, after that we use a hash set
+	static constexpr const idx_t SORTED_LOOKUP_THRESHOLD = 16;
+
+public:
+	explicit InFilter(vector<Value> values);
+
+	//! The (non-NULL) values to filter on, all of the same type
+	vector<Value> values;
+
+public:
+	//! Filters the rows in "sel" whose value in "input" is not in the set (or NULL)
+	idx_t Filter(Vector &input, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	//! The typed lookup structure that is built from the values
+	shared_ptr<InFilterLookup> lookup;
+};
+
+} // namespace duckdb
@@ -28,7 +28,10 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	BLOOM_FILTER = 6,  // approximate set membership (e.g. pushed from a hash join build side)
+	IN_FILTER = 7,     // exact set membership (e.g. IN (C1, C2, ...))
+	DYNAMIC_FILTER = 8 // comparison with a constant that is set while the query runs (e.g. a Top N boundary)
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -110,6 +110,8 @@ private:
 	static BufferHandle LoadFromBuffer(shared_ptr<BlockHandle> &handle, data_ptr_t data,
 	                                   unique_ptr<FileBuffer> reusable_buffer);
 	unique_ptr<FileBuffer> UnloadAndTakeBlock();
+	//! Registers a pin of the loaded block (the block must be locked), the block is re-used if nobody holds a pin
+	void RegisterReuse();
 	void Unload();
 	bool CanUnload();
 
@@ -127,6 +129,12 @@ private:
 	unique_ptr<FileBuffer> buffer;
 	//! Internal eviction sequence number
 	atomic<idx_t> eviction_seq_num;
+	//! The index of the eviction queue the latest version of this block was added to
+	idx_t eviction_queue_idx;
+	//! Whether the buffer was re-used since it was last added to the eviction queue (used by the 2Q policy)
+	bool accessed;
+	//! Whether the buffer was loaded by a prefetch and has not been pinned since
+	bool prefetched;
 	//! LRU timestamp (for age-based eviction)
 	atomic<int64_t> lru_timestamp_msec;
 	//! Whether or not the buffer can be destroyed (only used for temporary buffers)
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/array.hpp"
+#include "duckdb/common/enums/eviction_policy.hpp"
 #include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
@@ -19,6 +20,7 @@ namespace duckdb {
 
 class TemporaryMemoryManager;
 struct EvictionQueue;
+struct GhostQueue;
 
 struct BufferEvictionNode {
 	BufferEvictionNode() {
@@ -32,6 +34,23 @@ struct BufferEvictionNode {
 	shared_ptr<BlockHandle> TryGetBlockHandle();
 };
 
+//! Counters of one of the eviction queues of the BufferPool
+struct EvictionQueueInformation {
+	//! The type of the buffers in the queue
+	FileBufferType type;
+	//! Whether this is the queue of the buffers that have been re-used (only used by the TWO_QUEUE policy)
+	bool protected_queue;
+	//! The total number of buffers that were added to the queue
+	idx_t insertions;
+	//! The total number of pins of buffers that were unpinned in the queue
+	idx_t hits;
+	//! The total number of buffers that were evicted from the queue
+	idx_t evictions;
+	//! The total number of buffers that were loaded again while they were in the ghost queue, after they were evicted
+	//! from this queue
+	idx_t ghost_hits;
+};
+
 //! The BufferPool is in charge of handling memory management for one or more databases. It defines memory limits
 //! and implements priority eviction among all users of the pool.
 class BufferPool {
@@ -58,6 +77,18 @@ public:
 
 	TemporaryMemoryManager &GetTemporaryMemoryManager();
 
+	//! Sets the policy used to evict the unpinned buffers of the given type
+	void SetEvictionPolicy(FileBufferType type, EvictionPolicy policy);
+	EvictionPolicy GetEvictionPolicy(FileBufferType type) const;
+
+	//! Registers a pin of a buffer with the given tag, "hit" indicates whether the buffer was already loaded
+	void RegisterPin(MemoryTag tag, bool hit);
+	idx_t GetBufferHits(MemoryTag tag) const;
+	idx_t GetBufferMisses(MemoryTag tag) const;
+	idx_t GetEvictions(MemoryTag tag) const;
+	//! Returns the counters of all eviction queues
+	vector<EvictionQueueInformation> GetEvictionQueueInformation() const;
+
 protected:
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
 	//! (i.e. not enough blocks could be evicted)
@@ -82,10 +113,21 @@ protected:
 	//! Add a buffer handle to the eviction queue. Returns true, if the queue is
 	//! ready to be purged, and false otherwise.
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
-	//! Gets the eviction queue for the specified type
+	//! Gets the (first) eviction queue for the specified type
 	EvictionQueue &GetEvictionQueueForType(FileBufferType type);
-	//! Increments the dead nodes for the queue with specified type
-	void IncrementDeadNodes(FileBufferType type);
+	//! Gets the index of the eviction queue for the specified type, "protected_queue" selects the queue of the
+	//! buffers that have been re-used (only used by the TWO_QUEUE policy)
+	idx_t GetEvictionQueueIndex(FileBufferType type, bool protected_queue) const;
+	//! Increments the dead nodes for the queue the latest version of the handle was added to
+	void IncrementDeadNodes(const BlockHandle &handle);
+	//! Registers a pin of a loaded buffer (the buffer must be locked) in the eviction queue it was unpinned in
+	void RegisterQueueHit(const BlockHandle &handle);
+	//! Adds a persistent block that is evicted from the queue of the buffers that have been used once to the ghost
+	//! queue (only used by the TWO_QUEUE policy)
+	void AddToGhostQueue(const BlockHandle &handle);
+	//! Removes a persistent block that is loaded from the ghost queue, returns true if the block was in the ghost
+	//! queue, i.e., if it is re-used shortly after it was evicted
+	bool RemoveFromGhostQueue(const BlockHandle &handle);
 
 protected:
 	enum class MemoryUsageCaches {
@@ -137,8 +179,21 @@ protected:
 	atomic<idx_t> maximum_memory;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool track_eviction_timestamps;
-	//! Eviction queues
+	//! Eviction queues, EVICTION_QUEUES_PER_TYPE per FileBufferType, ordered by eviction priority
 	vector<unique_ptr<EvictionQueue>> queues;
+	//! The number of eviction queues per FileBufferType: one for buffers that have been used once, and one for
+	//! buffers that have been re-used
+	static constexpr idx_t EVICTION_QUEUES_PER_TYPE = 2;
+	//! The eviction policy per FileBufferType
+	array<atomic<EvictionPolicy>, FILE_BUFFER_TYPE_COUNT> eviction_policies;
+	//! The ids of the persistent blocks that were recently evicted under the TWO_QUEUE policy
+	unique_ptr<GhostQueue> ghost_queue;
+	//! The number of pins of buffers that were already loaded, per memory tag
+	array<atomic<idx_t>, MEMORY_TAG_COUNT> buffer_hits;
+	//! The number of pins of buffers that had to be loaded, per memory tag
+	array<atomic<idx_t>, MEMORY_TAG_COUNT> buffer_misses;
+	//! The number of buffers that were evicted, per memory tag
+	array<atomic<idx_t>, MEMORY_TAG_COUNT> evictions;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
 	unique_ptr<TemporaryMemoryManager> temporary_memory_manager;
 	//! To improve performance, MemoryUsage maintains counter caches based on current cpu or thread id,
@@ -9,11 +9,23 @@ struct MemoryInformation {
 	MemoryTag tag;
 	idx_t size;
 	idx_t evicted_data;
+	//! The number of pins of buffers that were already loaded in memory
+	idx_t buffer_hits;
+	//! The number of pins of buffers that had to be loaded from disk or the temporary directory
+	idx_t buffer_misses;
+	//! The number of buffers that were evicted from memory
+	idx_t evictions;
 };
 
 struct TemporaryFileInformation {
 	string path;
 	idx_t size;
+	//! The size in bytes of a single (possibly compressed) block in the file
+	idx_t slot_size;
+	//! The number of blocks that are currently stored in the file
+	idx_t block_count;
+	//! The size in bytes the blocks stored in the file would take up when uncompressed
+	idx_t uncompressed_size;
 };
 
 } // namespace duckdb
@@ -55,6 +55,8 @@ public:
 	virtual idx_t GetBlockAllocSize() const = 0;
 	//! Returns the block size for buffer-managed blocks.
 	virtual idx_t GetBlockSize() const = 0;
+	//! Returns the number of blocks that were loaded ahead of their use by batched prefetch reads
+	virtual idx_t GetPrefetchedBlockCount() const;
 
 	//! Returns a new block of transient memory.
 	virtual shared_ptr<BlockHandle> RegisterTransientMemory(const idx_t size, const idx_t block_size);
@@ -46,7 +46,7 @@ public:
 		next_vector_byte_index_start = AlpRDConstants::HEADER_SIZE + actual_dictionary_size_bytes;
 		memcpy((void *)state.left_parts_dict, (void *)analyze_state->state.left_parts_dict,
 		       actual_dictionary_size_bytes);
-		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		CreateEmptySegment(checkpointer.GetStartRow());
 	}
 
 	ColumnDataCheckpointer &checkpointer;
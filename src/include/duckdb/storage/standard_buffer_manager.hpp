@@ -59,6 +59,8 @@ public:
 	idx_t GetBlockAllocSize() const final;
 	//! Returns the block size for buffer-managed blocks.
 	idx_t GetBlockSize() const final;
+	//! Returns the number of blocks that were loaded ahead of their use by batched prefetch reads
+	idx_t GetPrefetchedBlockCount() const final;
 
 	//! Allocate an in-memory buffer with a single pin.
 	//! The allocated memory is released when the buffer handle is destroyed.
@@ -179,6 +181,8 @@ protected:
 	unique_ptr<BlockManager> temp_block_manager;
 	//! Temporary evicted memory data per tag
 	atomic<idx_t> evicted_data_per_tag[MEMORY_TAG_COUNT];
+	//! The number of blocks that were loaded by batched prefetch reads
+	atomic<idx_t> prefetched_blocks;
 };
 
 } // namespace duckdb
@@ -36,6 +36,13 @@ public:
 	virtual void RevertCommit() = 0;
 	// Make the commit persistent
 	virtual void FlushCommit() = 0;
+	//! Whether the commit was written as part of a group commit, and still has to be synced by calling SyncCommit
+	virtual bool HasPendingSync() {
+		return false;
+	}
+	//! Wait until a commit that was written as part of a group commit is durable
+	virtual void SyncCommit() {
+	}
 
 	virtual void AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
 	                             unique_ptr<PersistentCollectionData> row_group_data) = 0;
@@ -84,6 +91,10 @@ public:
 	optional_ptr<WriteAheadLog> GetWAL();
 	//! Deletes the WAL file, and resets the unique pointer.
 	void ResetWAL();
+	//! Gets the statistics of the WAL replay when the database was loaded
+	const WALReplayStatistics &GetWALReplayStatistics() const {
+		return wal_replay_statistics;
+	}
 
 	//! Returns the database file path
 	string GetDBPath() const {
@@ -115,6 +126,8 @@ protected:
 	string path;
 	//! The WriteAheadLog of the storage manager
 	unique_ptr<WriteAheadLog> wal;
+	//! The statistics of the WAL replay when the database was loaded
+	WALReplayStatistics wal_replay_statistics;
 	//! Whether or not the database is opened in read-only mode
 	bool read_only;
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
@@ -185,6 +185,11 @@ protected:
 	template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
 	idx_t ScanVector(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
 	                 idx_t target_scan);
+	//! Whether the next vector can be filtered directly on the compressed data of the current segment
+	bool CanFilterVector(ColumnScanState &state, const TableFilter &filter, idx_t scan_count);
+	//! Scans a base vector from the current segment, and evaluates the filter on the compressed data
+	idx_t FilterVector(ColumnScanState &state, Vector &result, idx_t scan_count, SelectionVector &sel,
+	                   idx_t &sel_count, const TableFilter &filter);
 
 	void ClearUpdates();
 	void FetchUpdates(TransactionData transaction, idx_t vector_index, Vector &result, idx_t scan_count,
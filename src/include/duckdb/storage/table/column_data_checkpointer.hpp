@@ -16,6 +16,12 @@ namespace duckdb {
 struct TableScanOptions;
 
 class ColumnDataCheckpointer {
+public:
+	//! The last unchanged segment before the changes is usually only partially filled - it is only kept during an
+	//! incremental checkpoint if it has at least this many rows, otherwise it is rewritten together with the changes
+	//! to prevent fragmenting the column into small segments
+	static constexpr const idx_t MINIMUM_REUSE_COUNT = Storage::ROW_GROUP_SIZE / 2;
+
 public:
 	ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup &row_group_p, ColumnCheckpointState &state_p,
 	                       ColumnCheckpointInfo &checkpoint_info);
@@ -25,6 +31,8 @@ public:
 	const LogicalType &GetType() const;
 	ColumnData &GetColumnData();
 	RowGroup &GetRowGroup();
+	//! The first row of the segments that are (re)written by the checkpoint
+	idx_t GetStartRow() const;
 	ColumnCheckpointState &GetCheckpointState();
 
 	void Checkpoint(vector<SegmentNode<ColumnSegment>> nodes);
@@ -35,7 +43,9 @@ private:
 	unique_ptr<AnalyzeState> DetectBestCompressionMethod(idx_t &compression_idx);
 	void WriteToDisk();
 	bool HasChanges();
-	void WritePersistentSegments();
+	bool HasChanges(ColumnSegment &segment);
+	idx_t GetReusableSegmentCount();
+	void WritePersistentSegments(idx_t segment_count);
 
 private:
 	ColumnData &col_data;
@@ -44,6 +54,7 @@ private:
 	bool is_validity;
 	Vector intermediate;
 	vector<SegmentNode<ColumnSegment>> nodes;
+	idx_t start_row;
 	vector<optional_ptr<CompressionFunction>> compression_functions;
 	ColumnCheckpointInfo &checkpoint_info;
 };
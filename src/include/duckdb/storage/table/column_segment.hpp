@@ -74,6 +74,17 @@ public:
 
 	static idx_t FilterSelection(SelectionVector &sel, Vector &vector, UnifiedVectorFormat &vdata,
 	                             const TableFilter &filter, idx_t scan_count, idx_t &approved_tuple_count);
+	//! Whether or not the filter can be evaluated directly on the compressed data of this segment
+	bool SupportsFilter(const TableFilter &filter) const;
+	//! Scan one entire vector from this segment, and refine "sel" with the filter (see compression_filter_t)
+	void Filter(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel, idx_t &sel_count,
+	            const TableFilter &filter);
+	//! Whether the result of the filter depends only on the value of a row, and the filter rejects NULL values
+	static bool IsValueFilter(const TableFilter &filter);
+	//! Evaluate a value filter on "count" (distinct) values, and set "matches[i]" for each value that passes it
+	static void FilterValues(Vector &values, idx_t count, const TableFilter &filter, bool *matches);
+	//! Refine "sel" to the rows for which "row_matches" is set
+	static void SelectMatches(SelectionVector &sel, idx_t &sel_count, const bool *row_matches);
 
 	//! Skip a scan forward to the row_index specified in the scan state
 	void Skip(ColumnScanState &state);
@@ -26,6 +26,7 @@ class ColumnData;
 class DatabaseInstance;
 class DataTable;
 class PartialBlockManager;
+struct PrefetchState;
 struct DataTableInfo;
 class ExpressionExecutor;
 class RowGroupCollection;
@@ -188,6 +189,10 @@ private:
 	idx_t GetColumnCount() const;
 	vector<shared_ptr<ColumnData>> &GetColumns();
 
+	//! Reads ahead the blocks of the upcoming vectors (starting at current_row) of the scanned columns
+	void Prefetch(CollectionScanState &state, idx_t current_row);
+	//! Collect the blocks of the next "count" rows of all columns that are scanned
+	void CollectPrefetchBlocks(CollectionScanState &state, PrefetchState &prefetch_state, idx_t count);
 	template <TableScanType TYPE>
 	void TemplatedScan(TransactionData transaction, CollectionScanState &state, DataChunk &result);
 
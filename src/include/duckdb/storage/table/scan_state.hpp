@@ -34,6 +34,10 @@ class ColumnData;
 class DuckTransaction;
 class RowGroupSegmentTree;
 class TableFilter;
+class BlockHandle;
+class BufferManager;
+class TaskExecutor;
+class TaskScheduler;
 struct AdaptiveFilterState;
 struct TableScanOptions;
 
@@ -170,6 +174,7 @@ private:
 class CollectionScanState {
 public:
 	explicit CollectionScanState(TableScanState &parent_p);
+	~CollectionScanState();
 
 	//! The current row_group we are scanning
 	RowGroup *row_group;
@@ -187,6 +192,14 @@ public:
 	idx_t batch_index;
 	//! The valid selection
 	SelectionVector valid_sel;
+	//! The row (within the current row_group) up to which blocks have been prefetched
+	idx_t prefetch_row;
+	//! Pins on the blocks that were prefetched for the upcoming vectors of the current row_group
+	vector<BufferHandle> prefetch_handles;
+	//! Executor of the read-ahead that loads the blocks of the window after the prefetched one in the background
+	unique_ptr<TaskExecutor> read_ahead_executor;
+	//! Pins on the blocks that were read ahead - filled in by the read-ahead task
+	vector<BufferHandle> read_ahead_handles;
 
 public:
 	void Initialize(const vector<LogicalType> &types);
@@ -197,6 +210,14 @@ public:
 	bool ScanCommitted(DataChunk &result, TableScanType type);
 	bool ScanCommitted(DataChunk &result, SegmentLock &l, TableScanType type);
 
+	//! Load and pin the blocks in the background, while the scan processes the blocks it prefetched before
+	void ScheduleReadAhead(TaskScheduler &scheduler, BufferManager &buffer_manager,
+	                       vector<shared_ptr<BlockHandle>> blocks);
+	//! Wait for the pending read-ahead (if any) to finish. The pinned blocks are left in read_ahead_handles.
+	void FinishReadAhead();
+	//! Release the pins on all prefetched and read-ahead blocks
+	void ReleasePrefetchedBlocks();
+
 private:
 	TableScanState &parent;
 };
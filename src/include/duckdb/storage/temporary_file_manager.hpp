@@ -27,7 +27,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t slot_size);
 	BlockIndexManager();
 
 public:
@@ -38,6 +38,8 @@ public:
 	bool RemoveIndex(idx_t index);
 	idx_t GetMaxIndex();
 	bool HasFreeBlocks();
+	//! Returns the number of block indexes that are currently in use
+	idx_t GetBlockCount();
 
 private:
 	void SetMaxIndex(idx_t blocks);
@@ -45,6 +47,8 @@ private:
 
 private:
 	idx_t max_index;
+	//! The size in bytes of every block index (used to register the size on disk with the manager)
+	idx_t slot_size;
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
@@ -70,12 +74,14 @@ public:
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+//! A TemporaryFileHandle stores blocks in fixed-size slots. Uncompressed blocks use slots of the block allocation
+//! size, compressed blocks are grouped by the (smaller) slot size they were rounded up to.
 class TemporaryFileHandle {
 	constexpr static idx_t MAX_ALLOWED_INDEX_BASE = 4000;
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    idx_t slot_size, TemporaryFileManager &manager);
 
 public:
 	struct TemporaryFileLock {
@@ -88,11 +94,17 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
+	//! Writes an uncompressed buffer to the slot at the given index
 	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Writes a compressed buffer (of exactly slot_size bytes) to the slot at the given index
+	void WriteTemporaryFile(data_ptr_t compressed_data, TemporaryFileIndex index);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
+	idx_t GetSlotSize() const;
+	//! Whether or not the blocks in this file are compressed
+	bool IsCompressed() const;
 
 private:
 	void CreateFileIfNotExists(TemporaryFileLock &);
@@ -104,6 +116,8 @@ private:
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
+	//! The size in bytes of a single slot in this file
+	idx_t slot_size;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
@@ -132,6 +146,10 @@ private:
 //===--------------------------------------------------------------------===//
 
 class TemporaryFileManager {
+public:
+	//! Compressed buffers are rounded up to a multiple of this size to limit the number of distinct slot sizes
+	static constexpr idx_t COMPRESSED_SLOT_GRANULARITY = 32ULL * 1024ULL;
+
 public:
 	TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p);
 	~TemporaryFileManager();
@@ -159,6 +177,9 @@ public:
 	void DecreaseSizeOnDisk(idx_t amount);
 
 private:
+	//! Tries to compress the buffer into compressed_data, returns the slot size of the compressed buffer
+	//! Returns the block allocation size if the buffer does not compress well enough to fit into a smaller slot
+	idx_t CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_data);
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
@@ -20,6 +20,8 @@
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -38,6 +40,39 @@ class TransactionManager;
 class WriteAheadLogDeserializer;
 struct PersistentCollectionData;
 
+//! Statistics about the commits that were made durable by syncing the WAL
+struct WALCommitStatistics {
+	//! The number of commits that were made durable
+	idx_t commits = 0;
+	//! The number of syncs of the WAL file that made commits durable
+	idx_t syncs = 0;
+	//! The largest number of commits that were made durable by a single sync
+	idx_t max_batch_size = 0;
+	//! The total and the maximum time spent syncing the WAL file (in microseconds)
+	idx_t total_sync_time_us = 0;
+	idx_t max_sync_time_us = 0;
+};
+
+//! Statistics about the replay of the WAL when the database was loaded
+struct WALReplayStatistics {
+	//! The size of the WAL file
+	idx_t wal_size = 0;
+	//! The number of bytes of the WAL that belong to replayed (committed) transactions
+	idx_t replayed_bytes = 0;
+	//! The number of entries that were read from the WAL
+	idx_t entries = 0;
+	//! The number of transactions that were replayed
+	idx_t transactions = 0;
+	//! The number of batches in which inserts were replayed in parallel
+	idx_t insert_batches = 0;
+	//! The maximum number of threads that replayed a batch of inserts
+	idx_t replay_threads = 0;
+	//! The time spent replaying the WAL (in microseconds)
+	idx_t replay_time_us = 0;
+	//! Whether or not a checkpoint was made right after the WAL was replayed
+	bool checkpointed = false;
+};
+
 //! The WriteAheadLog (WAL) is a log that is used to provide durability. Prior
 //! to committing a transaction it writes the changes the transaction made to
 //! the database to the log, which can then be replayed upon startup in case the
@@ -50,7 +85,9 @@ public:
 
 public:
 	//! Replay the WAL
-	static bool Replay(AttachedDatabase &database, unique_ptr<FileHandle> handle);
+	//! Catalog changes, deletes and updates are replayed in order, inserts into tables are batched and replayed in
+	//! parallel
+	static bool Replay(AttachedDatabase &database, unique_ptr<FileHandle> handle, WALReplayStatistics &statistics);
 
 	//! Gets the total bytes written to the WAL since startup
 	idx_t GetWALSize();
@@ -114,8 +151,23 @@ public:
 	void Delete();
 	void Flush();
 
+	//! Write the end of a commit to the WAL and sync it
+	void FlushCommit();
+	//! Write the end of a commit to the WAL, but only hand it to the OS without syncing it (group commit)
+	//! Returns the sequence number of the commit that has to be passed to SyncCommit to make it durable
+	idx_t WriteCommit();
+	//! Wait until the commit with the given sequence number is durable
+	//! A single thread syncs the WAL for all commits that were written up to that point, after waiting for at most
+	//! "max_delay_us" microseconds for other commits to join the batch
+	void SyncCommit(idx_t commit_sequence, idx_t max_delay_us);
+	//! Returns the statistics of the commits that were made durable
+	WALCommitStatistics GetCommitStatistics();
+
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
+private:
+	void RecordSync(idx_t batch_size, double sync_time);
+
 protected:
 	AttachedDatabase &database;
 	mutex wal_lock;
@@ -123,6 +175,18 @@ protected:
 	string wal_path;
 	atomic<idx_t> wal_size;
 	atomic<bool> initialized;
+
+private:
+	//! Protects the group commit state and the commit statistics
+	mutex commit_lock;
+	std::condition_variable commit_cv;
+	//! The sequence number of the last commit that was written (but not necessarily synced)
+	atomic<idx_t> written_commit_sequence;
+	//! The sequence number of the last commit that was synced
+	idx_t synced_commit_sequence = 0;
+	//! Whether or not a thread is currently syncing the WAL for a group of commits
+	bool sync_in_progress = false;
+	WALCommitStatistics commit_statistics;
 };
 
 } // namespace duckdb
@@ -61,6 +61,9 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AllowPersistentSecrets),
     DUCKDB_GLOBAL(CatalogErrorMaxSchema),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
+    DUCKDB_GLOBAL(CheckpointOnWALReplaySetting),
+    DUCKDB_GLOBAL(WALGroupCommitSetting),
+    DUCKDB_GLOBAL(WALGroupCommitDelaySetting),
     DUCKDB_GLOBAL(DebugCheckpointAbort),
     DUCKDB_GLOBAL(DebugSkipCheckpointOnCommit),
     DUCKDB_GLOBAL(StorageCompatibilityVersion),
@@ -89,6 +92,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(EnableProfilingSetting),
     DUCKDB_LOCAL(EnableProgressBarSetting),
     DUCKDB_LOCAL(EnableProgressBarPrintSetting),
+    DUCKDB_GLOBAL(EvictionPolicySetting),
     DUCKDB_LOCAL(ErrorsAsJsonSetting),
     DUCKDB_LOCAL(ExplainOutputSetting),
     DUCKDB_GLOBAL(ExtensionDirectorySetting),
@@ -103,6 +107,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(LockConfigurationSetting),
     DUCKDB_GLOBAL(IEEEFloatingPointOpsSetting),
     DUCKDB_GLOBAL(ImmediateTransactionModeSetting),
+    DUCKDB_GLOBAL(IncrementalCheckpointSetting),
     DUCKDB_LOCAL(IntegerDivisionSetting),
     DUCKDB_LOCAL(MaximumExpressionDepthSetting),
     DUCKDB_LOCAL(StreamingBufferSize),
@@ -126,12 +131,15 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL_ALIAS("profiling_output", ProfileOutputSetting),
     DUCKDB_LOCAL(CustomProfilingSettings),
     DUCKDB_LOCAL(ProgressBarTimeSetting),
+    DUCKDB_LOCAL(QueryPrioritySetting),
+    DUCKDB_GLOBAL(ScanPrefetchDepthSetting),
     DUCKDB_LOCAL(SchemaSetting),
     DUCKDB_LOCAL(SearchPathSetting),
     DUCKDB_GLOBAL(ScalarSubqueryErrorOnMultipleRows),
     DUCKDB_GLOBAL(SecretDirectorySetting),
     DUCKDB_GLOBAL(DefaultSecretStorage),
     DUCKDB_GLOBAL(TempDirectorySetting),
+    DUCKDB_GLOBAL(TempFileCompressionSetting),
     DUCKDB_GLOBAL(ThreadsSetting),
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL(ExportLargeBufferArrow),
@@ -438,6 +438,9 @@ void DatabaseInstance::Configure(DBConfig &new_config, const char *database_path
 		config.buffer_pool = make_shared_ptr<BufferPool>(config.options.maximum_memory,
 		                                                 config.options.buffer_manager_track_eviction_timestamps);
 	}
+	for (uint8_t type_idx = 1; type_idx <= FILE_BUFFER_TYPE_COUNT; type_idx++) {
+		config.buffer_pool->SetEvictionPolicy(FileBufferType(type_idx), config.options.eviction_policies[type_idx - 1]);
+	}
 }
 
 DBConfig &DBConfig::GetConfig(ClientContext &context) {
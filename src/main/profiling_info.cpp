@@ -28,6 +28,7 @@ profiler_settings_t ProfilingInfo::DefaultOperatorSettings() {
 
 profiler_settings_t ProfilingInfo::AllSettings() {
 	auto all_settings = DefaultSettings();
+	all_settings.insert(MetricsType::TASK_TIME);
 	auto optimizer_settings = MetricsUtils::GetOptimizerMetrics();
 	auto phase_timings = MetricsUtils::GetPhaseTimingMetrics();
 
@@ -61,7 +62,8 @@ void ProfilingInfo::ResetMetrics() {
 		case MetricsType::QUERY_NAME:
 		case MetricsType::BLOCKED_THREAD_TIME:
 		case MetricsType::CPU_TIME:
-		case MetricsType::OPERATOR_TIMING: {
+		case MetricsType::OPERATOR_TIMING:
+		case MetricsType::TASK_TIME: {
 			metrics[metric] = Value::CreateValue(0.0);
 			break;
 		}
@@ -175,7 +177,8 @@ void ProfilingInfo::WriteMetricsToJSON(yyjson_mut_doc *doc, yyjson_mut_val *dest
 			break;
 		case MetricsType::BLOCKED_THREAD_TIME:
 		case MetricsType::CPU_TIME:
-		case MetricsType::OPERATOR_TIMING: {
+		case MetricsType::OPERATOR_TIMING:
+		case MetricsType::TASK_TIME: {
 			yyjson_mut_obj_add_real(doc, dest, key_ptr, metrics[metric].GetValue<double>());
 			break;
 		}
@@ -83,6 +83,8 @@ void QueryProfiler::StartQuery(string query, bool is_explain_analyze_p, bool sta
 
 	running = true;
 	query_info.query_name = std::move(query);
+	query_info.blocked_thread_time = 0;
+	query_info.task_time = 0;
 	tree_map.clear();
 	root = nullptr;
 	phase_timings.clear();
@@ -191,6 +193,9 @@ void QueryProfiler::EndQuery() {
 			if (info.Enabled(MetricsType::BLOCKED_THREAD_TIME)) {
 				info.metrics[MetricsType::BLOCKED_THREAD_TIME] = query_info.blocked_thread_time;
 			}
+			if (info.Enabled(MetricsType::TASK_TIME)) {
+				info.metrics[MetricsType::TASK_TIME] = query_info.task_time;
+			}
 			if (info.Enabled(MetricsType::OPERATOR_TIMING)) {
 				info.metrics[MetricsType::OPERATOR_TIMING] = main_query.Elapsed();
 			}
@@ -406,13 +411,19 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 	profiler.timings.clear();
 }
 
-void QueryProfiler::SetInfo(const double &blocked_thread_time) {
+void QueryProfiler::SetInfo(const double &blocked_thread_time, const double &task_time) {
 	lock_guard<mutex> guard(flush_lock);
-	if (!IsEnabled() || !running || !root->GetProfilingInfo().Enabled(MetricsType::BLOCKED_THREAD_TIME)) {
+	if (!IsEnabled() || !running) {
 		return;
 	}
 
-	query_info.blocked_thread_time = blocked_thread_time;
+	auto &info = root->GetProfilingInfo();
+	if (info.Enabled(MetricsType::BLOCKED_THREAD_TIME)) {
+		query_info.blocked_thread_time = blocked_thread_time;
+	}
+	if (info.Enabled(MetricsType::TASK_TIME)) {
+		query_info.task_time = task_time;
+	}
 }
 
 string QueryProfiler::DrawPadded(const string &str, idx_t width) {
@@ -13,6 +13,7 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/expression_binder.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
@@ -111,6 +112,54 @@ Value CheckpointThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Checkpoint On WAL Replay
+//===--------------------------------------------------------------------===//
+void CheckpointOnWALReplaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.checkpoint_on_wal_replay = input.GetValue<bool>();
+}
+
+void CheckpointOnWALReplaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.checkpoint_on_wal_replay = DBConfig().options.checkpoint_on_wal_replay;
+}
+
+Value CheckpointOnWALReplaySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.checkpoint_on_wal_replay);
+}
+
+//===--------------------------------------------------------------------===//
+// WAL Group Commit
+//===--------------------------------------------------------------------===//
+void WALGroupCommitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_group_commit = input.GetValue<bool>();
+}
+
+void WALGroupCommitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_group_commit = DBConfig().options.wal_group_commit;
+}
+
+Value WALGroupCommitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.wal_group_commit);
+}
+
+//===--------------------------------------------------------------------===//
+// WAL Group Commit Delay
+//===--------------------------------------------------------------------===//
+void WALGroupCommitDelaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_group_commit_delay = input.GetValue<idx_t>();
+}
+
+void WALGroupCommitDelaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_group_commit_delay = DBConfig().options.wal_group_commit_delay;
+}
+
+Value WALGroupCommitDelaySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.wal_group_commit_delay);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -922,6 +971,81 @@ Value EnableProgressBarPrintSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).print_progress_bar);
 }
 
+//===--------------------------------------------------------------------===//
+// Eviction Policy
+//===--------------------------------------------------------------------===//
+static EvictionPolicy ParseEvictionPolicy(const string &input) {
+	auto policy = StringUtil::Upper(input);
+	StringUtil::Trim(policy);
+	if (policy == "LRU") {
+		return EvictionPolicy::LRU;
+	}
+	if (policy == "2Q" || policy == "TWO_QUEUE") {
+		return EvictionPolicy::TWO_QUEUE;
+	}
+	throw InvalidInputException("Unrecognized eviction policy \"%s\" - expected LRU or 2Q", input);
+}
+
+static FileBufferType ParseFileBufferType(const string &input) {
+	auto type_name = StringUtil::Upper(input);
+	StringUtil::Trim(type_name);
+	for (uint8_t type_idx = 1; type_idx <= FILE_BUFFER_TYPE_COUNT; type_idx++) {
+		auto type = FileBufferType(type_idx);
+		if (type_name == EnumUtil::ToString(type)) {
+			return type;
+		}
+	}
+	throw InvalidInputException(
+	    "Unrecognized buffer type \"%s\" - expected BLOCK, MANAGED_BUFFER or TINY_BUFFER", input);
+}
+
+static void ApplyEvictionPolicies(DatabaseInstance *db, DBConfig &config) {
+	if (!db) {
+		return;
+	}
+	auto &buffer_pool = BufferManager::GetBufferManager(*db).GetBufferPool();
+	for (uint8_t type_idx = 1; type_idx <= FILE_BUFFER_TYPE_COUNT; type_idx++) {
+		buffer_pool.SetEvictionPolicy(FileBufferType(type_idx), config.options.eviction_policies[type_idx - 1]);
+	}
+}
+
+void EvictionPolicySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto policies = config.options.eviction_policies;
+	for (auto &entry : StringUtil::Split(input.ToString(), ',')) {
+		auto separator = entry.find('=');
+		if (separator == string::npos) {
+			// a single policy for all buffer types
+			auto policy = ParseEvictionPolicy(entry);
+			for (auto &type_policy : policies) {
+				type_policy = policy;
+			}
+			continue;
+		}
+		auto type = ParseFileBufferType(entry.substr(0, separator));
+		policies[uint8_t(type) - 1] = ParseEvictionPolicy(entry.substr(separator + 1));
+	}
+	config.options.eviction_policies = policies;
+	ApplyEvictionPolicies(db, config);
+}
+
+void EvictionPolicySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.eviction_policies = DBConfig().options.eviction_policies;
+	ApplyEvictionPolicies(db, config);
+}
+
+Value EvictionPolicySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	string result;
+	for (uint8_t type_idx = 1; type_idx <= FILE_BUFFER_TYPE_COUNT; type_idx++) {
+		if (!result.empty()) {
+			result += ", ";
+		}
+		result += EnumUtil::ToString(FileBufferType(type_idx)) + "=" +
+		          EnumUtil::ToString(config.options.eviction_policies[type_idx - 1]);
+	}
+	return Value(result);
+}
+
 //===--------------------------------------------------------------------===//
 // Errors As JSON
 //===--------------------------------------------------------------------===//
@@ -1198,6 +1322,22 @@ Value ImmediateTransactionModeSetting::GetSetting(const ClientContext &context)
 	return Value::BOOLEAN(config.options.immediate_transaction_mode);
 }
 
+//===--------------------------------------------------------------------===//
+// Incremental Checkpoint
+//===--------------------------------------------------------------------===//
+void IncrementalCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.incremental_checkpoint = BooleanValue::Get(input);
+}
+
+void IncrementalCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.incremental_checkpoint = DBConfig().options.incremental_checkpoint;
+}
+
+Value IncrementalCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.incremental_checkpoint);
+}
+
 //===--------------------------------------------------------------------===//
 // Maximum Expression Depth
 //===--------------------------------------------------------------------===//
@@ -1697,6 +1837,42 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Priority
+//===--------------------------------------------------------------------===//
+void QueryPrioritySetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_priority = ClientConfig().query_priority;
+}
+
+void QueryPrioritySetting::SetLocal(ClientContext &context, const Value &input) {
+	const auto param = input.GetValue<uint64_t>();
+	if (param < 1 || param > MAX_PRIORITY) {
+		throw InvalidInputException("Invalid option for query_priority, value must be between 1 and %llu",
+		                            MAX_PRIORITY);
+	}
+	ClientConfig::GetConfig(context).query_priority = param;
+}
+
+Value QueryPrioritySetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).query_priority);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan Prefetch Depth
+//===--------------------------------------------------------------------===//
+void ScanPrefetchDepthSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.scan_prefetch_depth = input.GetValue<idx_t>();
+}
+
+void ScanPrefetchDepthSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.scan_prefetch_depth = DBConfig().options.scan_prefetch_depth;
+}
+
+Value ScanPrefetchDepthSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.scan_prefetch_depth);
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -1781,6 +1957,22 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
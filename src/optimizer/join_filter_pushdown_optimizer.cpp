@@ -122,6 +122,7 @@ void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &joi
 		get.dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
 	}
 	pushdown_info->dynamic_filters = get.dynamic_filters;
+	pushdown_info->in_filter_pushdown = get.function.in_filter_pushdown;
 
 	// set up the min/max aggregates for each of the filters
 	vector<AggregateFunction> aggr_functions;
@@ -1,12 +1,23 @@
 #include "duckdb/optimizer/topn_optimizer.hpp"
 
 #include "duckdb/common/limits.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
 
+TopN::TopN(Optimizer &optimizer) : optimizer(optimizer) {
+}
+
 bool TopN::CanOptimize(LogicalOperator &op) {
 	if (op.type == LogicalOperatorType::LOGICAL_LIMIT) {
 		auto &limit = op.Cast<LogicalLimit>();
@@ -67,6 +78,9 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 			cardinality = topn->children[0]->estimated_cardinality;
 		}
 		topn->SetEstimatedCardinality(cardinality);
+		if (!TryLateMaterialization(*topn)) {
+			PushDynamicFilter(*topn);
+		}
 		op = std::move(topn);
 
 		// reconstruct all projection nodes above limit operator
@@ -84,4 +98,261 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 	return op;
 }
 
+//! Replace the references to the output of a projection by the expressions of the projection
+static void ReplaceProjectionReferences(unique_ptr<Expression> &expr, LogicalProjection &proj) {
+	if (expr->type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = expr->Cast<BoundColumnRefExpression>();
+		if (colref.depth == 0 && colref.binding.table_index == proj.table_index) {
+			expr = proj.expressions[colref.binding.column_index]->Copy();
+		}
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(
+	    *expr, [&](unique_ptr<Expression> &child) { ReplaceProjectionReferences(child, proj); });
+}
+
+bool TopN::TryLateMaterialization(LogicalTopN &topn) {
+	if (topn.limit > LATE_MATERIALIZATION_MAX_ROWS || topn.offset > LATE_MATERIALIZATION_MAX_ROWS - topn.limit) {
+		// too many rows to fetch
+		return false;
+	}
+
+	// look for a table scan below the projections (if any)
+	vector<reference<LogicalProjection>> projections;
+	reference<unique_ptr<LogicalOperator>> source(topn.children[0]);
+	while (source.get()->type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		projections.push_back(source.get()->Cast<LogicalProjection>());
+		source = source.get()->children[0];
+	}
+	if (source.get()->type != LogicalOperatorType::LOGICAL_GET) {
+		return false;
+	}
+	auto &get = source.get()->Cast<LogicalGet>();
+	if (!get.function.filter_pushdown || !get.function.row_id_filter_pushdown || !get.GetTable() ||
+	    !get.children.empty() || !get.projected_input.empty() || get.dynamic_filters || get.GetColumnIds().empty()) {
+		// we need to be able to push a filter on the row ids into the scan
+		return false;
+	}
+	if (get.EstimateCardinality(optimizer.GetContext()) < LATE_MATERIALIZATION_MIN_CARDINALITY) {
+		// the table is small, fetching rows would not save much
+		return false;
+	}
+
+	// express the orders in terms of the columns of the scan
+	vector<BoundOrderByNode> scan_orders;
+	for (auto &order : topn.orders) {
+		if (order.expression->IsVolatile()) {
+			return false;
+		}
+		auto expr = order.expression->Copy();
+		for (auto &proj : projections) {
+			ReplaceProjectionReferences(expr, proj.get());
+		}
+		scan_orders.emplace_back(order.type, order.null_order, std::move(expr));
+	}
+	// collect the columns of the scan that we need for sorting
+	vector<idx_t> key_columns;
+	bool supported = true;
+	for (auto &order : scan_orders) {
+		ExpressionIterator::EnumerateExpression(order.expression, [&](Expression &child) {
+			if (child.type != ExpressionType::BOUND_COLUMN_REF) {
+				return;
+			}
+			auto &colref = child.Cast<BoundColumnRefExpression>();
+			if (colref.depth != 0 || colref.binding.table_index != get.table_index) {
+				supported = false;
+				return;
+			}
+			if (std::find(key_columns.begin(), key_columns.end(), colref.binding.column_index) == key_columns.end()) {
+				key_columns.push_back(colref.binding.column_index);
+			}
+		});
+	}
+	if (!supported) {
+		return false;
+	}
+	// only worth it if the scan produces other columns than the ones we sort on
+	idx_t deferred_columns = 0;
+	for (auto &binding : get.GetColumnBindings()) {
+		auto column_id = get.GetColumnIds()[binding.column_index];
+		if (!IsRowIdColumnId(column_id) &&
+		    std::find(key_columns.begin(), key_columns.end(), binding.column_index) == key_columns.end()) {
+			deferred_columns++;
+		}
+	}
+	if (deferred_columns == 0) {
+		return false;
+	}
+	// the filters are keyed by the column id in the table, the filtered columns have to be scanned as well
+	for (auto &entry : get.table_filters.filters) {
+		auto &scanned_ids = get.GetColumnIds();
+		if (std::find(scanned_ids.begin(), scanned_ids.end(), entry.first) == scanned_ids.end()) {
+			return false;
+		}
+	}
+
+	// the table scan needs to produce the row ids to join on
+	idx_t row_id_idx;
+	auto &column_ids = get.GetColumnIds();
+	auto row_id_entry = std::find(column_ids.begin(), column_ids.end(), COLUMN_IDENTIFIER_ROW_ID);
+	if (row_id_entry != column_ids.end()) {
+		row_id_idx = NumericCast<idx_t>(row_id_entry - column_ids.begin());
+	} else {
+		row_id_idx = column_ids.size();
+		get.AddColumnId(COLUMN_IDENTIFIER_ROW_ID);
+	}
+	if (!get.projection_ids.empty() &&
+	    std::find(get.projection_ids.begin(), get.projection_ids.end(), row_id_idx) == get.projection_ids.end()) {
+		get.projection_ids.push_back(row_id_idx);
+	}
+
+	// create a second scan of the table that only reads the ordering columns, the filtered columns and the row ids
+	vector<column_t> scan_column_ids;
+	unordered_map<idx_t, idx_t> column_map;
+	auto map_column = [&](idx_t column_idx) {
+		if (column_map.find(column_idx) == column_map.end()) {
+			column_map[column_idx] = scan_column_ids.size();
+			scan_column_ids.push_back(get.GetColumnIds()[column_idx]);
+		}
+		return column_map[column_idx];
+	};
+	vector<idx_t> scan_projection_ids;
+	for (auto &column_idx : key_columns) {
+		scan_projection_ids.push_back(map_column(column_idx));
+	}
+	const auto scan_row_id_idx = map_column(row_id_idx);
+	scan_projection_ids.push_back(scan_row_id_idx);
+
+	auto scan_table_index = optimizer.binder.GenerateTableIndex();
+	auto scan = make_uniq<LogicalGet>(scan_table_index, get.function, get.bind_data ? get.bind_data->Copy() : nullptr,
+	                                  get.returned_types, get.names);
+	for (auto &entry : get.table_filters.filters) {
+		auto filter_column = std::find(column_ids.begin(), column_ids.end(), entry.first);
+		D_ASSERT(filter_column != column_ids.end());
+		map_column(NumericCast<idx_t>(filter_column - column_ids.begin()));
+		scan->table_filters.filters[entry.first] = entry.second->Copy();
+	}
+	if (scan_column_ids.size() > scan_projection_ids.size() && get.function.filter_prune) {
+		// the filtered columns do not need to leave the scan
+		scan->projection_ids = std::move(scan_projection_ids);
+	}
+	scan->SetColumnIds(std::move(scan_column_ids));
+	scan->parameters = get.parameters;
+	scan->named_parameters = get.named_parameters;
+	scan->input_table_types = get.input_table_types;
+	scan->input_table_names = get.input_table_names;
+	if (get.has_estimated_cardinality) {
+		scan->SetEstimatedCardinality(get.estimated_cardinality);
+	}
+
+	// sort only the ordering columns + row ids
+	for (auto &order : scan_orders) {
+		ExpressionIterator::EnumerateExpression(order.expression, [&](Expression &child) {
+			if (child.type == ExpressionType::BOUND_COLUMN_REF) {
+				auto &colref = child.Cast<BoundColumnRefExpression>();
+				colref.binding = ColumnBinding(scan_table_index, column_map[colref.binding.column_index]);
+			}
+		});
+	}
+	auto row_ids = make_uniq<LogicalTopN>(std::move(scan_orders), topn.limit + topn.offset, 0);
+	row_ids->AddChild(std::move(scan));
+	row_ids->SetEstimatedCardinality(topn.limit + topn.offset);
+	PushDynamicFilter(*row_ids);
+
+	// fetch the remaining columns for the surviving row ids: the join pushes the row ids into the original scan
+	// the original TopN remains on top of the join to sort the (at most LIMIT + OFFSET) fetched rows again
+	JoinCondition condition;
+	condition.left = make_uniq<BoundColumnRefExpression>("rowid", LogicalType::ROW_TYPE,
+	                                                     ColumnBinding(get.table_index, row_id_idx));
+	condition.right = make_uniq<BoundColumnRefExpression>("rowid", LogicalType::ROW_TYPE,
+	                                                      ColumnBinding(scan_table_index, scan_row_id_idx));
+	condition.comparison = ExpressionType::COMPARE_EQUAL;
+
+	auto join = make_uniq<LogicalComparisonJoin>(JoinType::SEMI);
+	join->conditions.push_back(std::move(condition));
+	join->AddChild(std::move(source.get()));
+	join->AddChild(std::move(row_ids));
+	join->SetEstimatedCardinality(topn.limit + topn.offset);
+	source.get() = std::move(join);
+	return true;
+}
+
+static bool TypeSupportsDynamicFilter(const LogicalType &type) {
+	// the order of these types is the same as the order of their values in a comparison
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::UHUGEINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void TopN::PushDynamicFilter(LogicalTopN &topn) {
+	if (topn.limit == 0 || topn.dynamic_filter) {
+		return;
+	}
+	auto &order = topn.orders[0];
+	if (order.null_order != OrderByNullType::NULLS_LAST || !TypeSupportsDynamicFilter(order.expression->return_type)) {
+		// NULL values are not accepted by a comparison, so they have to come after the boundary
+		return;
+	}
+	if (order.expression->type != ExpressionType::BOUND_COLUMN_REF) {
+		return;
+	}
+	// follow the column through the projections and filters to the table scan
+	auto binding = order.expression->Cast<BoundColumnRefExpression>().binding;
+	reference<LogicalOperator> source(*topn.children[0]);
+	while (true) {
+		if (source.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+			auto &proj = source.get().Cast<LogicalProjection>();
+			if (binding.table_index != proj.table_index) {
+				return;
+			}
+			auto &expr = *proj.expressions[binding.column_index];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				return;
+			}
+			binding = expr.Cast<BoundColumnRefExpression>().binding;
+		} else if (source.get().type != LogicalOperatorType::LOGICAL_FILTER) {
+			break;
+		}
+		source = *source.get().children[0];
+	}
+	if (source.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return;
+	}
+	auto &get = source.get().Cast<LogicalGet>();
+	if (!get.function.filter_pushdown || !get.function.dynamic_filter_pushdown ||
+	    binding.table_index != get.table_index) {
+		return;
+	}
+	auto column_id = get.GetColumnIds()[binding.column_index];
+	if (IsRowIdColumnId(column_id) || column_id >= get.returned_types.size() ||
+	    get.returned_types[column_id] != order.expression->return_type) {
+		return;
+	}
+	topn.dynamic_filter = make_shared_ptr<DynamicFilterData>();
+	get.table_filters.PushFilter(column_id, make_uniq<DynamicFilter>(topn.dynamic_filter));
+}
+
 } // namespace duckdb
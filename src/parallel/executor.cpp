@@ -390,6 +390,7 @@ void Executor::InitializeInternal(PhysicalOperator &plan) {
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(plan);
 		this->producer = scheduler.CreateProducer();
+		this->producer->statistics->priority = ClientConfig::GetConfig(context).query_priority;
 
 		// build and ready the pipelines
 		PipelineBuildState state;
@@ -451,7 +452,7 @@ void Executor::WorkOnTasks() {
 
 	shared_ptr<Task> task_from_producer;
 	while (scheduler.GetTaskFromProducer(*producer, task_from_producer)) {
-		auto res = task_from_producer->Execute(TaskExecutionMode::PROCESS_ALL);
+		auto res = TaskScheduler::ExecuteTask(*task_from_producer, TaskExecutionMode::PROCESS_ALL);
 		if (res == TaskExecutionResult::TASK_BLOCKED) {
 			task_from_producer->Deschedule();
 		}
@@ -571,7 +572,7 @@ PendingExecutionResult Executor::ExecuteTask(bool dry_run) {
 
 		if (current_task) {
 			// if we have a task, partially process it
-			auto result = task->Execute(TaskExecutionMode::PROCESS_PARTIAL);
+			auto result = TaskScheduler::ExecuteTask(*task, TaskExecutionMode::PROCESS_PARTIAL);
 			if (result == TaskExecutionResult::TASK_BLOCKED) {
 				task->Deschedule();
 				task.reset();
@@ -674,7 +675,8 @@ void Executor::Flush(ThreadContext &thread_context) {
 		global_profiler->Flush(thread_context.profiler);
 
 		auto blocked_time = blocked_thread_time.load();
-		global_profiler->SetInfo(double(blocked_time * WAIT_TIME_MS.count()) / 1000);
+		auto task_time = producer ? producer->statistics->task_time_us.load() : 0;
+		global_profiler->SetInfo(double(blocked_time * WAIT_TIME_MS.count()) / 1000, double(task_time) / 1000000);
 	}
 }
 
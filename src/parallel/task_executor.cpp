@@ -37,7 +37,7 @@ void TaskExecutor::WorkOnTasks() {
 	// repeatedly execute tasks until we are finished
 	shared_ptr<Task> task_from_producer;
 	while (scheduler.GetTaskFromProducer(*token, task_from_producer)) {
-		auto res = task_from_producer->Execute(TaskExecutionMode::PROCESS_ALL);
+		auto res = TaskScheduler::ExecuteTask(*task_from_producer, TaskExecutionMode::PROCESS_ALL);
 		(void)res;
 		D_ASSERT(res != TaskExecutionResult::TASK_BLOCKED);
 		task_from_producer.reset();
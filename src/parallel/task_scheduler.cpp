@@ -1,6 +1,7 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
 #include "duckdb/common/chrono.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/numeric_utils.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -34,6 +35,108 @@ struct SchedulerThread {
 #endif
 };
 
+//! A task queue that is (preferably) used by threads running on a single CPU
+//! The queue is protected by a lock, as other threads can steal tasks from it
+struct LocalTaskQueue {
+	struct Entry {
+		Entry(ProducerToken &producer, shared_ptr<Task> task) : producer(producer), task(std::move(task)) {
+		}
+
+		reference<ProducerToken> producer;
+		shared_ptr<Task> task;
+	};
+
+	mutex lock;
+	deque<Entry> tasks;
+	//! The number of tasks in the queue, so that empty queues can be skipped without grabbing the lock
+	atomic<idx_t> size {0};
+
+	//! Counters, exposed through the duckdb_task_queues() table function
+	atomic<idx_t> scheduled_tasks {0};
+	atomic<idx_t> local_tasks {0};
+	atomic<idx_t> stolen_tasks {0};
+	atomic<idx_t> idle_time_us {0};
+
+	void Enqueue(ProducerToken &producer, shared_ptr<Task> task) {
+		lock_guard<mutex> guard(lock);
+		tasks.emplace_back(producer, std::move(task));
+		size++;
+		scheduled_tasks++;
+	}
+
+	//! Take the oldest task from the queue (used by threads running on the CPU of this queue)
+	bool Dequeue(shared_ptr<Task> &task) {
+		if (size == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		task = std::move(tasks.front().task);
+		tasks.pop_front();
+		size--;
+		local_tasks++;
+		return true;
+	}
+
+	//! Take the newest task from the queue (used by threads running on other CPUs)
+	bool Steal(shared_ptr<Task> &task) {
+		if (size == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		task = std::move(tasks.back().task);
+		tasks.pop_back();
+		size--;
+		stolen_tasks++;
+		return true;
+	}
+
+	//! Take the oldest task of a producer whose virtual time does not exceed max_virtual_time
+	bool DequeueFairShare(idx_t max_virtual_time, bool is_local, shared_ptr<Task> &task) {
+		if (size == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		for (auto it = tasks.begin(); it != tasks.end(); it++) {
+			if (it->task->producer_statistics->virtual_time_us <= max_virtual_time) {
+				task = std::move(it->task);
+				tasks.erase(it);
+				size--;
+				if (is_local) {
+					local_tasks++;
+				} else {
+					stolen_tasks++;
+				}
+				return true;
+			}
+		}
+		return false;
+	}
+
+	//! Take the oldest task that was scheduled by a specific producer
+	bool DequeueFromProducer(ProducerToken &producer, shared_ptr<Task> &task) {
+		if (size == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		for (auto it = tasks.begin(); it != tasks.end(); it++) {
+			if (RefersToSameObject(it->producer.get(), producer)) {
+				task = std::move(it->task);
+				tasks.erase(it);
+				size--;
+				local_tasks++;
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
 #ifndef DUCKDB_NO_THREADS
 typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
@@ -41,6 +144,7 @@ typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 struct ConcurrentQueue {
 	concurrent_queue_t q;
 	lightweight_semaphore_t semaphore;
+	atomic<idx_t> scheduled_tasks {0};
 
 	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
@@ -56,6 +160,7 @@ struct QueueProducerToken {
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
 	if (q.enqueue(token.token->queue_token, std::move(task))) {
+		scheduled_tasks++;
 		semaphore.signal();
 	} else {
 		throw InternalException("Could not schedule task!");
@@ -111,18 +216,26 @@ private:
 #endif
 
 ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
-    : scheduler(scheduler), token(std::move(token)) {
+    : scheduler(scheduler), token(std::move(token)), statistics(make_shared_ptr<ProducerStatistics>()) {
 }
 
 ProducerToken::~ProducerToken() {
+	scheduler.UnregisterProducer(*this);
 }
 
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
-    : db(db), queue(make_uniq<ConcurrentQueue>()),
+    : db(db), queue(make_uniq<ConcurrentQueue>()), background_thread_count(0), active_producer_count(0),
+      min_virtual_time_us(0), rebalance_producers(false), rebalance_counter(0),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold),
       allocator_background_threads(db.config.options.allocator_background_threads), requested_thread_count(0),
       current_thread_count(1) {
 	SetAllocatorBackgroundThreads(db.config.options.allocator_background_threads);
+#ifndef DUCKDB_NO_THREADS
+	auto local_queue_count = MinValue<idx_t>(MaxValue<idx_t>(std::thread::hardware_concurrency(), 1), MAX_LOCAL_QUEUES);
+	for (idx_t i = 0; i < local_queue_count; i++) {
+		local_queues.push_back(make_uniq<LocalTaskQueue>());
+	}
+#endif
 }
 
 TaskScheduler::~TaskScheduler() {
@@ -145,16 +258,183 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 
 unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
 	auto token = make_uniq<QueueProducerToken>(*queue);
-	return make_uniq<ProducerToken>(*this, std::move(token));
+	auto result = make_uniq<ProducerToken>(*this, std::move(token));
+	// start at the virtual time of the other producers, so the new producer does not get to catch up on them
+	result->statistics->virtual_time_us = min_virtual_time_us.load();
+
+	lock_guard<mutex> guard(producer_lock);
+	producers.insert(*result);
+	return result;
+}
+
+void TaskScheduler::UnregisterProducer(ProducerToken &token) {
+	lock_guard<mutex> guard(producer_lock);
+	producers.erase(token);
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
+	task->producer_statistics = token.statistics;
+	if (token.statistics->queued_tasks++ == 0) {
+		active_producer_count++;
+	}
+#ifndef DUCKDB_NO_THREADS
+	if (background_thread_count > 0) {
+		// place the task in the queue of the current CPU, where it is likely to be picked up by the same thread
+		GetLocalQueue().Enqueue(token, std::move(task));
+		queue->semaphore.signal();
+		return;
+	}
+#endif
 	// Enqueue a task for the given producer token and signal any sleeping threads
 	queue->Enqueue(token, std::move(task));
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	return queue->DequeueFromProducer(token, task);
+	if (queue->DequeueFromProducer(token, task)) {
+		TaskDequeued(*task);
+		return true;
+	}
+	// the tasks of this producer might have been scheduled in one of the local queues
+	for (auto &local_queue : local_queues) {
+		if (local_queue->DequeueFromProducer(token, task)) {
+			TaskDequeued(*task);
+			return true;
+		}
+	}
+	return false;
+}
+
+void TaskScheduler::TaskDequeued(Task &task) {
+	D_ASSERT(task.producer_statistics);
+	auto &statistics = *task.producer_statistics;
+	if (--statistics.queued_tasks == 0) {
+		active_producer_count--;
+	}
+	if (active_producer_count > 1 && statistics.virtual_time_us > min_virtual_time_us + FAIR_SHARE_SLACK_USECS) {
+		// this producer got ahead of the others: serve the producers by virtual time until they are balanced again
+		rebalance_producers = true;
+	}
+}
+
+TaskExecutionResult TaskScheduler::ExecuteTask(Task &task, TaskExecutionMode mode) {
+	// the producer can be destroyed as soon as the task is finished, so we keep its statistics alive ourselves
+	auto statistics = task.producer_statistics;
+	auto start = std::chrono::steady_clock::now();
+	auto result = task.Execute(mode);
+	auto task_time =
+	    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+	if (statistics) {
+		statistics->AddTaskTime(NumericCast<idx_t>(task_time));
+	}
+	return result;
+}
+
+bool TaskScheduler::DequeueFairShare(shared_ptr<Task> &task) {
+	if (rebalance_counter++ % REBALANCE_INTERVAL != 0) {
+		// take the oldest task of a producer that is not ahead of the others, preferring the queue of the current CPU
+		const auto max_virtual_time = min_virtual_time_us + FAIR_SHARE_SLACK_USECS;
+		const auto local_queue_idx = GetEstimatedCPUId() % local_queues.size();
+		for (idx_t i = 0; i < local_queues.size(); i++) {
+			auto &local_queue = *local_queues[(local_queue_idx + i) % local_queues.size()];
+			if (local_queue.DequeueFairShare(max_virtual_time, i == 0, task)) {
+				TaskDequeued(*task);
+				return true;
+			}
+		}
+	}
+	// recompute the fair share, and take a task of the producer with the lowest virtual time
+	// the producers cannot be destroyed while we hold the lock - if another thread holds it, we do not wait for it
+	unique_lock<mutex> guard(producer_lock, std::try_to_lock);
+	if (!guard.owns_lock()) {
+		return false;
+	}
+	optional_ptr<ProducerToken> next_producer;
+	idx_t active_producers = 0;
+	idx_t max_virtual_time = 0;
+	for (auto &entry : producers) {
+		auto &producer = entry.get();
+		auto &statistics = *producer.statistics;
+		if (statistics.queued_tasks == 0) {
+			continue;
+		}
+		active_producers++;
+		max_virtual_time = MaxValue<idx_t>(max_virtual_time, statistics.virtual_time_us);
+		if (!next_producer || statistics.virtual_time_us < next_producer->statistics->virtual_time_us) {
+			next_producer = &producer;
+		}
+	}
+	if (active_producers < 2) {
+		// nothing to balance - let the caller take the task that is closest to the current CPU
+		rebalance_producers = false;
+		return false;
+	}
+	min_virtual_time_us = next_producer->statistics->virtual_time_us.load();
+	// keep rebalancing as long as a producer is ahead of the others
+	rebalance_producers = max_virtual_time > min_virtual_time_us + FAIR_SHARE_SLACK_USECS;
+	return GetTaskFromProducer(*next_producer, task);
+}
+
+LocalTaskQueue &TaskScheduler::GetLocalQueue() {
+	D_ASSERT(!local_queues.empty());
+	return *local_queues[GetEstimatedCPUId() % local_queues.size()];
+}
+
+bool TaskScheduler::DequeueTask(shared_ptr<Task> &task) {
+#ifndef DUCKDB_NO_THREADS
+	if (rebalance_producers && active_producer_count > 1 && DequeueFairShare(task)) {
+		// multiple queries are competing for the threads and one of them got ahead: serve them by priority
+		return true;
+	}
+	const auto local_queue_idx = GetEstimatedCPUId() % local_queues.size();
+	if (local_queues[local_queue_idx]->Dequeue(task)) {
+		TaskDequeued(*task);
+		return true;
+	}
+	if (queue->q.try_dequeue(task)) {
+		TaskDequeued(*task);
+		return true;
+	}
+	// nothing to do on our own CPU: steal from the other queues
+	for (idx_t i = 1; i < local_queues.size(); i++) {
+		if (local_queues[(local_queue_idx + i) % local_queues.size()]->Steal(task)) {
+			TaskDequeued(*task);
+			return true;
+		}
+	}
+	return false;
+#else
+	throw NotImplementedException("DuckDB was compiled without threads! Dequeueing tasks is not allowed.");
+#endif
+}
+
+vector<TaskQueueInformation> TaskScheduler::GetTaskQueueInformation() {
+	vector<TaskQueueInformation> result;
+	TaskQueueInformation shared_info;
+	shared_info.queue_idx = DConstants::INVALID_INDEX;
+#ifndef DUCKDB_NO_THREADS
+	shared_info.queued_tasks = queue->q.size_approx();
+	shared_info.scheduled_tasks = queue->scheduled_tasks;
+#else
+	shared_info.queued_tasks = 0;
+	shared_info.scheduled_tasks = 0;
+#endif
+	shared_info.local_tasks = 0;
+	shared_info.stolen_tasks = 0;
+	shared_info.idle_time_us = 0;
+	result.push_back(shared_info);
+
+	for (idx_t i = 0; i < local_queues.size(); i++) {
+		auto &local_queue = *local_queues[i];
+		TaskQueueInformation info;
+		info.queue_idx = i;
+		info.queued_tasks = local_queue.size;
+		info.scheduled_tasks = local_queue.scheduled_tasks;
+		info.local_tasks = local_queue.local_tasks;
+		info.stolen_tasks = local_queue.stolen_tasks;
+		info.idle_time_us = local_queue.idle_time_us;
+		result.push_back(info);
+	}
+	return result;
 }
 
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
@@ -164,6 +444,7 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 	shared_ptr<Task> task;
 	// loop until the marker is set to false
 	while (*marker) {
+		auto idle_start = std::chrono::steady_clock::now();
 		if (!Allocator::SupportsFlush() || allocator_background_threads) {
 			// allocator can't flush, or background threads clean up allocations, just start an untimed wait
 			queue->semaphore.wait();
@@ -177,8 +458,11 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				queue->semaphore.wait();
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
-			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
+		auto idle_time =
+		    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - idle_start).count();
+		GetLocalQueue().idle_time_us += NumericCast<idx_t>(idle_time);
+		if (DequeueTask(task)) {
+			auto execute_result = ExecuteTask(*task, TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
 			case TaskExecutionResult::TASK_FINISHED:
@@ -210,10 +494,10 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!DequeueTask(task)) {
 			return completed_tasks;
 		}
-		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
+		auto execute_result = ExecuteTask(*task, TaskExecutionMode::PROCESS_ALL);
 
 		switch (execute_result) {
 		case TaskExecutionResult::TASK_FINISHED:
@@ -240,11 +524,11 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 	shared_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!DequeueTask(task)) {
 			return;
 		}
 		try {
-			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
+			auto execute_result = ExecuteTask(*task, TaskExecutionMode::PROCESS_ALL);
 			switch (execute_result) {
 			case TaskExecutionResult::TASK_FINISHED:
 			case TaskExecutionResult::TASK_ERROR:
@@ -370,6 +654,7 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 		// erase the threads/markers
 		threads.clear();
 		markers.clear();
+		background_thread_count = 0;
 	}
 	if (threads.size() < new_thread_count) {
 		// we are increasing the number of threads: launch them and run tasks on them
@@ -391,6 +676,7 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 			markers.push_back(std::move(marker));
 		}
 	}
+	background_thread_count = threads.size();
 	current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 	if (Allocator::SupportsFlush()) {
 		Allocator::FlushAll();
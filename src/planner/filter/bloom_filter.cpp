@@ -0,0 +1,84 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+BloomFilter::BloomFilter(LogicalType key_type_p, shared_ptr<BlockedBloomFilter> filter_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), key_type(std::move(key_type_p)), filter(std::move(filter_p)) {
+	D_ASSERT(filter);
+}
+
+idx_t BloomFilter::Filter(Vector &input, UnifiedVectorFormat &vdata, SelectionVector &sel,
+                          idx_t &approved_tuple_count) const {
+	if (approved_tuple_count == 0 || input.GetType() != key_type) {
+		// the hashes are only comparable if the types are identical - let everything through
+		return approved_tuple_count;
+	}
+	// NULL values can never be part of an equality join - remove them first
+	if (!vdata.validity.AllValid()) {
+		SelectionVector valid_sel(approved_tuple_count);
+		idx_t valid_count = 0;
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			valid_sel.set_index(valid_count, idx);
+			valid_count += vdata.validity.RowIsValid(vdata.sel->get_index(idx));
+		}
+		sel.Initialize(valid_sel);
+		approved_tuple_count = valid_count;
+	}
+
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(input, hashes, sel, approved_tuple_count);
+
+	SelectionVector result_sel(STANDARD_VECTOR_SIZE);
+	approved_tuple_count = filter->Lookup(hashes, sel, approved_tuple_count, result_sel);
+	sel.Initialize(result_sel);
+	return approved_tuple_count;
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	// the Bloom filter holds hashes only - we cannot reason about ranges
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM_FILTER";
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.key_type == key_type && other.filter.get() == filter.get();
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	return make_uniq<BloomFilter>(key_type, filter);
+}
+
+unique_ptr<Expression> BloomFilter::ToExpression(const Expression &column) const {
+	// the Bloom filter only ever removes rows that cannot match - dropping it is always correct
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+void BloomFilter::Serialize(Serializer &serializer) const {
+	TableFilter::Serialize(serializer);
+	serializer.WriteProperty(200, "key_type", key_type);
+	serializer.WriteObject(201, "filter", [&](Serializer &obj) { filter->Serialize(obj); });
+}
+
+unique_ptr<TableFilter> BloomFilter::Deserialize(Deserializer &deserializer) {
+	auto key_type = deserializer.ReadProperty<LogicalType>(200, "key_type");
+	shared_ptr<BlockedBloomFilter> filter;
+	deserializer.ReadObject(201, "filter",
+	                        [&](Deserializer &obj) { filter = BlockedBloomFilter::Deserialize(obj); });
+	return make_uniq<BloomFilter>(std::move(key_type), std::move(filter));
+}
+
+} // namespace duckdb
@@ -0,0 +1,72 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+void DynamicFilterData::SetValue(ExpressionType comparison_type, Value constant) {
+	lock_guard<mutex> guard(lock);
+	filter = make_uniq<ConstantFilter>(comparison_type, std::move(constant));
+	initialized = true;
+}
+
+void DynamicFilterData::Reset() {
+	lock_guard<mutex> guard(lock);
+	filter.reset();
+	initialized = false;
+}
+
+DynamicFilter::DynamicFilter() : DynamicFilter(make_shared_ptr<DynamicFilterData>()) {
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+	D_ASSERT(filter_data);
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	lock_guard<mutex> guard(filter_data->lock);
+	if (!filter_data->initialized) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return filter_data->filter->CheckStatistics(stats);
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	lock_guard<mutex> guard(filter_data->lock);
+	if (!filter_data->initialized) {
+		return "DYNAMIC_FILTER(" + column_name + ")";
+	}
+	return "DYNAMIC_FILTER(" + filter_data->filter->ToString(column_name) + ")";
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data.get() == filter_data.get();
+}
+
+unique_ptr<TableFilter> DynamicFilter::Copy() const {
+	return make_uniq<DynamicFilter>(filter_data);
+}
+
+unique_ptr<Expression> DynamicFilter::ToExpression(const Expression &column) const {
+	// the filter only ever removes rows that cannot be part of the result - dropping it is always correct
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+void DynamicFilter::Serialize(Serializer &serializer) const {
+	// the value of the filter is only known while the query is running - it is not serialized
+	TableFilter::Serialize(serializer);
+}
+
+unique_ptr<TableFilter> DynamicFilter::Deserialize(Deserializer &deserializer) {
+	return make_uniq<DynamicFilter>();
+}
+
+} // namespace duckdb
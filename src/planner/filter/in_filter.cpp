@@ -0,0 +1,244 @@
+#include "duckdb/planner/filter/in_filter.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+class InFilterLookup {
+public:
+	virtual ~InFilterLookup() {
+	}
+
+	//! Keeps the rows in "sel" that are valid and contained in the set, returns the number of remaining rows
+	virtual idx_t Select(UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t approved_tuple_count) const = 0;
+};
+
+template <class T, class LOOKUP>
+static idx_t TemplatedInSelect(UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t approved_tuple_count,
+                               const LOOKUP &lookup) {
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	// "sel" can be the incremental selection vector, so we write the result into a new one
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	if (vdata.validity.AllValid()) {
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			new_sel.set_index(result_count, idx);
+			result_count += lookup.Contains(data[vdata.sel->get_index(idx)]);
+		}
+	} else {
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			auto vector_idx = vdata.sel->get_index(idx);
+			new_sel.set_index(result_count, idx);
+			result_count += vdata.validity.RowIsValid(vector_idx) && lookup.Contains(data[vector_idx]);
+		}
+	}
+	sel.Initialize(new_sel);
+	return result_count;
+}
+
+//! Binary search over a sorted array, used for small sets
+template <class T>
+class SortedInFilterLookup : public InFilterLookup {
+public:
+	explicit SortedInFilterLookup(const vector<Value> &values) {
+		for (auto &value : values) {
+			sorted_values.push_back(value.GetValueUnsafe<T>());
+		}
+		std::sort(sorted_values.begin(), sorted_values.end(), LessThanComparator);
+	}
+
+	inline bool Contains(const T &input) const {
+		auto entry = std::lower_bound(sorted_values.begin(), sorted_values.end(), input, LessThanComparator);
+		return entry != sorted_values.end() && Equals::Operation<T>(*entry, input);
+	}
+
+	idx_t Select(UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t approved_tuple_count) const override {
+		return TemplatedInSelect<T>(vdata, sel, approved_tuple_count, *this);
+	}
+
+private:
+	static bool LessThanComparator(const T &left, const T &right) {
+		return LessThan::Operation<T>(left, right);
+	}
+
+private:
+	vector<T> sorted_values;
+};
+
+//! Hash set lookup, used for larger sets
+template <class T>
+class HashedInFilterLookup : public InFilterLookup {
+public:
+	explicit HashedInFilterLookup(const vector<Value> &values) {
+		for (auto &value : values) {
+			value_set.insert(value.GetValueUnsafe<T>());
+		}
+	}
+
+	inline bool Contains(const T &input) const {
+		return value_set.find(input) != value_set.end();
+	}
+
+	idx_t Select(UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t approved_tuple_count) const override {
+		return TemplatedInSelect<T>(vdata, sel, approved_tuple_count, *this);
+	}
+
+private:
+	struct ValueHash {
+		size_t operator()(const T &value) const {
+			return Hash<T>(value);
+		}
+	};
+	struct ValueEquality {
+		bool operator()(const T &left, const T &right) const {
+			return Equals::Operation<T>(left, right);
+		}
+	};
+
+private:
+	unordered_set<T, ValueHash, ValueEquality> value_set;
+};
+
+template <class T>
+static shared_ptr<InFilterLookup> CreateInFilterLookup(const vector<Value> &values) {
+	if (values.size() <= InFilter::SORTED_LOOKUP_THRESHOLD) {
+		return make_shared_ptr<SortedInFilterLookup<T>>(values);
+	}
+	return make_shared_ptr<HashedInFilterLookup<T>>(values);
+}
+
+static shared_ptr<InFilterLookup> CreateInFilterLookup(const LogicalType &type, const vector<Value> &values) {
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+		return CreateInFilterLookup<bool>(values);
+	case PhysicalType::UINT8:
+		return CreateInFilterLookup<uint8_t>(values);
+	case PhysicalType::UINT16:
+		return CreateInFilterLookup<uint16_t>(values);
+	case PhysicalType::UINT32:
+		return CreateInFilterLookup<uint32_t>(values);
+	case PhysicalType::UINT64:
+		return CreateInFilterLookup<uint64_t>(values);
+	case PhysicalType::UINT128:
+		return CreateInFilterLookup<uhugeint_t>(values);
+	case PhysicalType::INT8:
+		return CreateInFilterLookup<int8_t>(values);
+	case PhysicalType::INT16:
+		return CreateInFilterLookup<int16_t>(values);
+	case PhysicalType::INT32:
+		return CreateInFilterLookup<int32_t>(values);
+	case PhysicalType::INT64:
+		return CreateInFilterLookup<int64_t>(values);
+	case PhysicalType::INT128:
+		return CreateInFilterLookup<hugeint_t>(values);
+	case PhysicalType::FLOAT:
+		return CreateInFilterLookup<float>(values);
+	case PhysicalType::DOUBLE:
+		return CreateInFilterLookup<double>(values);
+	case PhysicalType::VARCHAR:
+		return CreateInFilterLookup<string_t>(values);
+	default:
+		throw InternalException("Unsupported type \"%s\" for InFilter", type.ToString());
+	}
+}
+
+InFilter::InFilter(vector<Value> values_p) : TableFilter(TableFilterType::IN_FILTER), values(std::move(values_p)) {
+	if (values.empty()) {
+		throw InternalException("InFilter requires at least one value");
+	}
+	for (auto &value : values) {
+		if (value.IsNull()) {
+			throw InternalException("InFilter values cannot be NULL");
+		}
+		if (value.type() != values[0].type()) {
+			throw InternalException("InFilter values must all have the same type");
+		}
+	}
+	lookup = CreateInFilterLookup(values[0].type(), values);
+}
+
+idx_t InFilter::Filter(Vector &input, UnifiedVectorFormat &vdata, SelectionVector &sel,
+                       idx_t &approved_tuple_count) const {
+	D_ASSERT(input.GetType().InternalType() == values[0].type().InternalType());
+	approved_tuple_count = lookup->Select(vdata, sel, approved_tuple_count);
+	return approved_tuple_count;
+}
+
+FilterPropagateResult InFilter::CheckStatistics(BaseStatistics &stats) {
+	switch (values[0].type().InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+	case PhysicalType::VARCHAR:
+		break;
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	// the filter can only be false for the segment if every single value is outside of the zonemap
+	auto result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	for (auto &value : values) {
+		FilterPropagateResult value_result;
+		if (value.type().InternalType() == PhysicalType::VARCHAR) {
+			value_result = StringStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, StringValue::Get(value));
+		} else {
+			value_result = NumericStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, value);
+		}
+		if (value_result == FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+			return FilterPropagateResult::FILTER_ALWAYS_TRUE;
+		}
+		if (value_result == FilterPropagateResult::NO_PRUNING_POSSIBLE) {
+			result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+	}
+	return result;
+}
+
+string InFilter::ToString(const string &column_name) {
+	string result = column_name + " IN (";
+	for (idx_t i = 0; i < values.size(); i++) {
+		if (i > 0) {
+			result += ", ";
+		}
+		result += values[i].ToSQLString();
+	}
+	return result + ")";
+}
+
+bool InFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<InFilter>();
+	return other.values == values;
+}
+
+unique_ptr<TableFilter> InFilter::Copy() const {
+	return make_uniq<InFilter>(values);
+}
+
+unique_ptr<Expression> InFilter::ToExpression(const Expression &column) const {
+	auto result = make_uniq<BoundOperatorExpression>(ExpressionType::COMPARE_IN, LogicalType::BOOLEAN);
+	result->children.push_back(column.Copy());
+	for (auto &value : values) {
+		result->children.push_back(make_uniq<BoundConstantExpression>(value));
+	}
+	return std::move(result);
+}
+
+} // namespace duckdb
@@ -62,11 +62,12 @@ DynamicTableFilterSet::GetFinalTableFilters(const PhysicalTableScan &scan,
 	}
 	for (auto &entry : filters) {
 		for (auto &filter : entry.second->filters) {
-			if (IsRowIdColumnId(scan.column_ids[filter.first])) {
-				// skip row id filters
+			if (IsRowIdColumnId(scan.column_ids[filter.first]) && !scan.function.row_id_filter_pushdown) {
+				// skip row id filters if the scan cannot apply them
 				continue;
 			}
-			result->filters[filter.first] = filter.second->Copy();
+			// AND the dynamic filter with any existing filter on the same column
+			result->PushFilter(filter.first, filter.second->Copy());
 		}
 	}
 	if (result->filters.empty()) {
@@ -11,7 +11,8 @@ namespace duckdb {
 
 BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, MemoryTag tag)
     : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag), buffer(nullptr), eviction_seq_num(0),
-      can_destroy(false), memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
+      eviction_queue_idx(0), accessed(false), prefetched(false), can_destroy(false),
+      memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
 	eviction_seq_num = 0;
 	state = BlockState::BLOCK_UNLOADED;
 	memory_usage = block_manager.GetBlockAllocSize();
@@ -21,8 +22,8 @@ BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, Mem
                          unique_ptr<FileBuffer> buffer_p, bool can_destroy_p, idx_t block_size,
                          BufferPoolReservation &&reservation)
     : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag), eviction_seq_num(0),
-      can_destroy(can_destroy_p), memory_charge(tag, block_manager.buffer_manager.GetBufferPool()),
-      unswizzled(nullptr) {
+      eviction_queue_idx(0), accessed(false), prefetched(false), can_destroy(can_destroy_p),
+      memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
 	buffer = std::move(buffer_p);
 	state = BlockState::BLOCK_LOADED;
 	memory_usage = block_size;
@@ -35,7 +36,7 @@ BlockHandle::~BlockHandle() { // NOLINT: allow internal exceptions
 	if (buffer && buffer->type != FileBufferType::TINY_BUFFER) {
 		// we kill the latest version in the eviction queue
 		auto &buffer_manager = block_manager.buffer_manager;
-		buffer_manager.GetBufferPool().IncrementDeadNodes(buffer->type);
+		buffer_manager.GetBufferPool().IncrementDeadNodes(*this);
 	}
 
 	// no references remain to this block: erase
@@ -105,6 +106,19 @@ BufferHandle BlockHandle::Load(shared_ptr<BlockHandle> &handle, unique_ptr<FileB
 	return BufferHandle(handle, handle->buffer.get());
 }
 
+void BlockHandle::RegisterReuse() {
+	if (readers > 0) {
+		// the block is pinned already, e.g., by another segment stored in the same block - not a new access
+		return;
+	}
+	if (prefetched) {
+		// the first pin after a prefetch is the access that the block was prefetched for
+		prefetched = false;
+		return;
+	}
+	accessed = true;
+}
+
 unique_ptr<FileBuffer> BlockHandle::UnloadAndTakeBlock() {
 	if (state == BlockState::BLOCK_UNLOADED) {
 		// already unloaded: nothing to do
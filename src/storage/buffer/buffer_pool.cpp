@@ -1,8 +1,11 @@
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 
 #include "duckdb/common/chrono.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/typedefs.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/parallel/concurrentqueue.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
@@ -61,6 +64,10 @@ public:
 	inline void DecrementDeadNodes() {
 		total_dead_nodes--;
 	}
+	//! The total number of insertions into the eviction queue.
+	inline idx_t GetInsertions() const {
+		return evict_queue_insertions;
+	}
 
 private:
 	//! Bulk purge dead nodes from the eviction queue. Then, enqueue those that are still alive.
@@ -69,6 +76,10 @@ private:
 public:
 	//! The concurrent queue
 	eviction_queue_t q;
+	//! Counters, exposed through the duckdb_eviction_queues() table function
+	atomic<idx_t> hits {0};
+	atomic<idx_t> evictions {0};
+	atomic<idx_t> ghost_hits {0};
 
 private:
 	//! We trigger a purge of the eviction queue every INSERT_INTERVAL insertions
@@ -192,20 +203,75 @@ void EvictionQueue::PurgeIteration(const idx_t purge_size) {
 	total_dead_nodes -= actually_dequeued - alive_nodes;
 }
 
+//! The ghost queue (A1out) of the TWO_QUEUE policy holds the ids of the persistent blocks that were recently evicted
+//! from the queue of the blocks that have been used once, but not their data. A block that is loaded again while it
+//! is in the ghost queue is re-used, and is added to the protected queue when it is unpinned.
+struct GhostQueue {
+	struct Key {
+		const BlockManager *block_manager;
+		block_id_t block_id;
+
+		bool operator==(const Key &other) const {
+			return block_manager == other.block_manager && block_id == other.block_id;
+		}
+	};
+	struct KeyHash {
+		hash_t operator()(const Key &key) const {
+			return CombineHash(Hash(static_cast<uint64_t>(CastPointerToValue(key.block_manager))), Hash(key.block_id));
+		}
+	};
+
+	//! The maximum number of blocks in the ghost queue, as a fraction of the blocks that fit in memory
+	constexpr static idx_t CAPACITY_DIVISOR = 2;
+
+	mutex lock;
+	//! The blocks in the order they were evicted, and the sequence number of their eviction
+	deque<pair<Key, idx_t>> queue;
+	//! The sequence number of the latest eviction of each block in the ghost queue
+	unordered_map<Key, idx_t, KeyHash> blocks;
+	idx_t sequence_number = 0;
+
+	void Add(const Key &key, idx_t capacity) {
+		lock_guard<mutex> guard(lock);
+		blocks[key] = ++sequence_number;
+		queue.emplace_back(key, sequence_number);
+		// blocks that are removed or evicted again leave outdated entries behind, these are skipped here
+		while (blocks.size() > capacity || queue.size() > capacity * 2) {
+			auto &front = queue.front();
+			auto entry = blocks.find(front.first);
+			if (entry != blocks.end() && entry->second == front.second) {
+				blocks.erase(entry);
+			}
+			queue.pop_front();
+		}
+	}
+
+	bool Remove(const Key &key) {
+		lock_guard<mutex> guard(lock);
+		return blocks.erase(key) > 0;
+	}
+};
+
 BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps)
     : maximum_memory(maximum_memory), track_eviction_timestamps(track_eviction_timestamps),
-      temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
-	queues.reserve(FILE_BUFFER_TYPE_COUNT);
-	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT; i++) {
+      ghost_queue(make_uniq<GhostQueue>()), temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
+	queues.reserve(FILE_BUFFER_TYPE_COUNT * EVICTION_QUEUES_PER_TYPE);
+	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT * EVICTION_QUEUES_PER_TYPE; i++) {
 		queues.push_back(make_uniq<EvictionQueue>());
 	}
+	for (auto &policy : eviction_policies) {
+		policy = EvictionPolicy::LRU;
+	}
+	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
+		buffer_hits[i] = 0;
+		buffer_misses[i] = 0;
+		evictions[i] = 0;
+	}
 }
 BufferPool::~BufferPool() {
 }
 
 bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
-	auto &queue = GetEvictionQueueForType(handle->buffer->type);
-
 	// The block handle is locked during this operation (Unpin),
 	// or the block handle is still a local variable (ConvertToPersistent)
 	D_ASSERT(handle->readers == 0);
@@ -219,19 +285,97 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 
 	if (ts != 1) {
 		// we add a newer version, i.e., we kill exactly one previous version
-		queue.IncrementDeadNodes();
+		queues[handle->eviction_queue_idx]->IncrementDeadNodes();
 	}
 
 	// Get the eviction queue for the buffer type and add it
+	// with the 2Q policy, buffers that are re-used go to the protected queue, which is only evicted after the buffers
+	// that have been used once - this prevents large scans from flushing frequently used buffers out of memory
+	auto type = handle->buffer->type;
+	bool protected_queue = handle->accessed && GetEvictionPolicy(type) == EvictionPolicy::TWO_QUEUE;
+	handle->accessed = false;
+	handle->eviction_queue_idx = GetEvictionQueueIndex(type, protected_queue);
+	auto &queue = *queues[handle->eviction_queue_idx];
 	return queue.AddToEvictionQueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), ts));
 }
 
 EvictionQueue &BufferPool::GetEvictionQueueForType(FileBufferType type) {
-	return *queues[uint8_t(type) - 1];
+	return *queues[GetEvictionQueueIndex(type, false)];
+}
+
+idx_t BufferPool::GetEvictionQueueIndex(FileBufferType type, bool protected_queue) const {
+	return (uint8_t(type) - 1) * EVICTION_QUEUES_PER_TYPE + (protected_queue ? 1 : 0);
+}
+
+void BufferPool::IncrementDeadNodes(const BlockHandle &handle) {
+	queues[handle.eviction_queue_idx]->IncrementDeadNodes();
+}
+
+void BufferPool::SetEvictionPolicy(FileBufferType type, EvictionPolicy policy) {
+	eviction_policies[uint8_t(type) - 1] = policy;
+}
+
+EvictionPolicy BufferPool::GetEvictionPolicy(FileBufferType type) const {
+	return eviction_policies[uint8_t(type) - 1];
+}
+
+void BufferPool::RegisterPin(MemoryTag tag, bool hit) {
+	if (hit) {
+		buffer_hits[uint8_t(tag)].fetch_add(1, std::memory_order_relaxed);
+	} else {
+		buffer_misses[uint8_t(tag)].fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+idx_t BufferPool::GetBufferHits(MemoryTag tag) const {
+	return buffer_hits[uint8_t(tag)];
+}
+
+idx_t BufferPool::GetBufferMisses(MemoryTag tag) const {
+	return buffer_misses[uint8_t(tag)];
+}
+
+idx_t BufferPool::GetEvictions(MemoryTag tag) const {
+	return evictions[uint8_t(tag)];
+}
+
+vector<EvictionQueueInformation> BufferPool::GetEvictionQueueInformation() const {
+	vector<EvictionQueueInformation> result;
+	for (idx_t queue_idx = 0; queue_idx < queues.size(); queue_idx++) {
+		auto &queue = *queues[queue_idx];
+		EvictionQueueInformation info;
+		info.type = FileBufferType(queue_idx / EVICTION_QUEUES_PER_TYPE + 1);
+		info.protected_queue = queue_idx % EVICTION_QUEUES_PER_TYPE != 0;
+		info.insertions = queue.GetInsertions();
+		info.hits = queue.hits;
+		info.evictions = queue.evictions;
+		info.ghost_hits = queue.ghost_hits;
+		result.push_back(info);
+	}
+	return result;
+}
+
+void BufferPool::RegisterQueueHit(const BlockHandle &handle) {
+	if (handle.readers == 0 && handle.eviction_seq_num > 0) {
+		// the buffer is not pinned: it is in the queue the latest version of the handle was added to
+		queues[handle.eviction_queue_idx]->hits.fetch_add(1, std::memory_order_relaxed);
+	}
 }
 
-void BufferPool::IncrementDeadNodes(FileBufferType type) {
-	GetEvictionQueueForType(type).IncrementDeadNodes();
+void BufferPool::AddToGhostQueue(const BlockHandle &handle) {
+	auto capacity = MaxValue<idx_t>(maximum_memory / DEFAULT_BLOCK_ALLOC_SIZE / GhostQueue::CAPACITY_DIVISOR, 1);
+	ghost_queue->Add({&handle.block_manager, handle.block_id}, capacity);
+}
+
+bool BufferPool::RemoveFromGhostQueue(const BlockHandle &handle) {
+	if (handle.block_id >= MAXIMUM_BLOCK || GetEvictionPolicy(FileBufferType::BLOCK) != EvictionPolicy::TWO_QUEUE) {
+		return false;
+	}
+	if (!ghost_queue->Remove({&handle.block_manager, handle.block_id})) {
+		return false;
+	}
+	GetEvictionQueueForType(FileBufferType::BLOCK).ghost_hits.fetch_add(1, std::memory_order_relaxed);
+	return true;
 }
 
 void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
@@ -256,23 +400,15 @@ TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
 
 BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
                                                    unique_ptr<FileBuffer> *buffer) {
-	// First, we try to evict persistent table data
-	auto block_result =
-	    EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::BLOCK), tag, extra_memory, memory_limit, buffer);
-	if (block_result.success) {
-		return block_result;
-	}
-
-	// If that does not succeed, we try to evict temporary data
-	auto managed_buffer_result = EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::MANAGED_BUFFER), tag,
-	                                                 extra_memory, memory_limit, buffer);
-	if (managed_buffer_result.success) {
-		return managed_buffer_result;
+	// The queues are ordered by eviction priority: first we try to evict persistent table data, then temporary data,
+	// and finally tiny buffers. For every type, buffers that have been used once are evicted before re-used buffers.
+	for (idx_t queue_idx = 0; queue_idx + 1 < queues.size(); queue_idx++) {
+		auto result = EvictBlocksInternal(*queues[queue_idx], tag, extra_memory, memory_limit, buffer);
+		if (result.success) {
+			return result;
+		}
 	}
-
-	// Finally, we try to evict tiny buffers
-	return EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::TINY_BUFFER), tag, extra_memory, memory_limit,
-	                           buffer);
+	return EvictBlocksInternal(*queues.back(), tag, extra_memory, memory_limit, buffer);
 }
 
 BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue, MemoryTag tag, idx_t extra_memory,
@@ -284,8 +420,16 @@ BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue,
 		return {true, std::move(r)};
 	}
 
+	// with the 2Q policy, we remember which persistent blocks that have been used once were evicted
+	bool track_evicted_blocks = &queue == &GetEvictionQueueForType(FileBufferType::BLOCK) &&
+	                            GetEvictionPolicy(FileBufferType::BLOCK) == EvictionPolicy::TWO_QUEUE;
 	queue.IterateUnloadableBlocks([&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
 		// hooray, we can unload the block
+		evictions[uint8_t(handle->tag)].fetch_add(1, std::memory_order_relaxed);
+		queue.evictions.fetch_add(1, std::memory_order_relaxed);
+		if (track_evicted_blocks && handle->BlockId() < MAXIMUM_BLOCK) {
+			AddToGhostQueue(*handle);
+		}
 		if (buffer && handle->buffer->AllocSize() == extra_memory) {
 			// we can re-use the memory directly
 			*buffer = handle->UnloadAndTakeBlock();
@@ -331,6 +475,8 @@ idx_t BufferPool::PurgeAgedBlocksInternal(EvictionQueue &queue, uint32_t max_age
 		// block is younger than the age threshold.
 		bool is_fresh = handle->lru_timestamp_msec >= limit && handle->lru_timestamp_msec <= now;
 		purged_bytes += handle->GetMemoryUsage();
+		evictions[uint8_t(handle->tag)].fetch_add(1, std::memory_order_relaxed);
+		queue.evictions.fetch_add(1, std::memory_order_relaxed);
 		handle->Unload();
 		return is_fresh;
 	});
@@ -372,7 +518,9 @@ void EvictionQueue::IterateUnloadableBlocks(FN fn) {
 }
 
 void BufferPool::PurgeQueue(FileBufferType type) {
-	GetEvictionQueueForType(type).Purge();
+	for (idx_t i = 0; i < EVICTION_QUEUES_PER_TYPE; i++) {
+		queues[GetEvictionQueueIndex(type, false) + i]->Purge();
+	}
 }
 
 void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
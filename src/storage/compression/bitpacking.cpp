@@ -376,7 +376,7 @@ public:
 	explicit BitpackingCompressState(ColumnDataCheckpointer &checkpointer, const CompressionInfo &info)
 	    : CompressionState(info), checkpointer(checkpointer),
 	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_BITPACKING)) {
-		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		CreateEmptySegment(checkpointer.GetStartRow());
 
 		state.data_ptr = reinterpret_cast<void *>(this);
 
@@ -881,6 +881,42 @@ void BitpackingScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_c
 	BitpackingScanPartial<T>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void BitpackingFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+                      SelectionVector &sel, idx_t &sel_count, const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<BitpackingScanState<T>>();
+	if (scan_state.current_group_offset == BITPACKING_METADATA_GROUP_SIZE) {
+		scan_state.LoadNextGroup();
+	}
+	// check if the vector lies entirely within a group with a constant value
+	auto is_constant = scan_state.current_group.mode == BitpackingMode::CONSTANT &&
+	                   scan_state.current_group_offset + vector_count <= BITPACKING_METADATA_GROUP_SIZE;
+	auto constant = scan_state.current_constant;
+
+	BitpackingScan<T>(segment, state, vector_count, result);
+	if (sel_count == 0) {
+		return;
+	}
+	if (!is_constant) {
+		// evaluate the filter on the unpacked values
+		UnifiedVectorFormat vdata;
+		result.ToUnifiedFormat(vector_count, vdata);
+		ColumnSegment::FilterSelection(sel, result, vdata, filter, vector_count, sel_count);
+		return;
+	}
+	// all values are the same: evaluate the filter once
+	Vector constant_vector(segment.type, 1);
+	FlatVector::GetData<T>(constant_vector)[0] = constant;
+	bool match;
+	ColumnSegment::FilterValues(constant_vector, 1, filter, &match);
+	if (!match) {
+		sel_count = 0;
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -952,11 +988,13 @@ void BitpackingSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_c
 //===--------------------------------------------------------------------===//
 template <class T, bool WRITE_STATISTICS = true>
 CompressionFunction GetBitpackingFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_BITPACKING, data_type, BitpackingInitAnalyze<T>,
-	                           BitpackingAnalyze<T>, BitpackingFinalAnalyze<T>,
-	                           BitpackingInitCompression<T, WRITE_STATISTICS>, BitpackingCompress<T, WRITE_STATISTICS>,
-	                           BitpackingFinalizeCompress<T, WRITE_STATISTICS>, BitpackingInitScan<T>,
-	                           BitpackingScan<T>, BitpackingScanPartial<T>, BitpackingFetchRow<T>, BitpackingSkip<T>);
+	CompressionFunction function(
+	    CompressionType::COMPRESSION_BITPACKING, data_type, BitpackingInitAnalyze<T>, BitpackingAnalyze<T>,
+	    BitpackingFinalAnalyze<T>, BitpackingInitCompression<T, WRITE_STATISTICS>,
+	    BitpackingCompress<T, WRITE_STATISTICS>, BitpackingFinalizeCompress<T, WRITE_STATISTICS>,
+	    BitpackingInitScan<T>, BitpackingScan<T>, BitpackingScanPartial<T>, BitpackingFetchRow<T>, BitpackingSkip<T>);
+	function.filter = BitpackingFilter<T>;
+	return function;
 }
 
 CompressionFunction BitpackingFun::GetFunction(PhysicalType type) {
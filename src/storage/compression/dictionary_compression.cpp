@@ -107,6 +107,8 @@ struct DictionaryCompressionStorage {
 	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
 	                              idx_t result_offset);
 	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+	                         SelectionVector &sel, idx_t &sel_count, const TableFilter &filter);
 	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
 	                           idx_t result_idx);
 
@@ -136,7 +138,7 @@ struct DictionaryCompressionCompressState : public DictionaryCompressionState {
 	    : DictionaryCompressionState(info), checkpointer(checkpointer_p),
 	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_DICTIONARY)),
 	      heap(BufferAllocator::Get(checkpointer.GetDatabase())) {
-		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		CreateEmptySegment(checkpointer.GetStartRow());
 	}
 
 	ColumnDataCheckpointer &checkpointer;
@@ -444,6 +446,10 @@ struct CompressedStringScanState : public StringScanState {
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
+	idx_t dictionary_size = 0;
+	//! The filter that was evaluated on the dictionary, and for each dictionary entry whether it passes the filter
+	optional_ptr<const TableFilter> filter;
+	unsafe_unique_array<bool> filter_matches;
 };
 
 unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(ColumnSegment &segment) {
@@ -463,6 +469,7 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 	auto index_buffer_ptr = reinterpret_cast<uint32_t *>(baseptr + index_buffer_offset);
 
 	state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
+	state->dictionary_size = index_buffer_count;
 	auto dict_child_data = FlatVector::GetData<string_t>(*(state->dictionary));
 
 	for (uint32_t i = 0; i < index_buffer_count; i++) {
@@ -554,6 +561,39 @@ void DictionaryCompressionStorage::StringScan(ColumnSegment &segment, ColumnScan
 	StringScanPartial<true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+void DictionaryCompressionStorage::StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count,
+                                                Vector &result, SelectionVector &sel, idx_t &sel_count,
+                                                const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<CompressedStringScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+
+	// evaluate the filter once for every string in the dictionary of this segment
+	if (scan_state.filter.get() != &filter) {
+		scan_state.filter_matches = make_unsafe_uniq_array<bool>(scan_state.dictionary_size);
+		ColumnSegment::FilterValues(*scan_state.dictionary, scan_state.dictionary_size, filter,
+		                            scan_state.filter_matches.get());
+		scan_state.filter = &filter;
+	}
+
+	// scan the values - this leaves the dictionary indexes of the scanned rows in the selection vector of the state
+	StringScan(segment, state, vector_count, result);
+	if (sel_count == 0) {
+		return;
+	}
+
+	// look up whether or not the rows pass the filter through their dictionary index
+	auto start_offset = start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+	auto &dictionary_indexes = *scan_state.sel_vec;
+	bool row_matches[STANDARD_VECTOR_SIZE];
+	for (idx_t i = 0; i < vector_count; i++) {
+		row_matches[i] = scan_state.filter_matches[dictionary_indexes.get_index(start_offset + i)];
+	}
+	ColumnSegment::SelectMatches(sel, sel_count, row_matches);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -651,13 +691,15 @@ uint16_t DictionaryCompressionStorage::GetStringLength(uint32_t *index_buffer_pt
 // Get Function
 //===--------------------------------------------------------------------===//
 CompressionFunction DictionaryCompressionFun::GetFunction(PhysicalType data_type) {
-	return CompressionFunction(
+	CompressionFunction function(
 	    CompressionType::COMPRESSION_DICTIONARY, data_type, DictionaryCompressionStorage ::StringInitAnalyze,
 	    DictionaryCompressionStorage::StringAnalyze, DictionaryCompressionStorage::StringFinalAnalyze,
 	    DictionaryCompressionStorage::InitCompression, DictionaryCompressionStorage::Compress,
 	    DictionaryCompressionStorage::FinalizeCompress, DictionaryCompressionStorage::StringInitScan,
 	    DictionaryCompressionStorage::StringScan, DictionaryCompressionStorage::StringScanPartial<false>,
 	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	function.filter = DictionaryCompressionStorage::StringFilter;
+	return function;
 }
 
 bool DictionaryCompressionFun::TypeIsSupported(const PhysicalType physical_type) {
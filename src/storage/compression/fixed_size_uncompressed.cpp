@@ -55,7 +55,7 @@ struct UncompressedCompressState : public CompressionState {
 
 UncompressedCompressState::UncompressedCompressState(ColumnDataCheckpointer &checkpointer, const CompressionInfo &info)
     : CompressionState(info), checkpointer(checkpointer) {
-	UncompressedCompressState::CreateEmptySegment(checkpointer.GetRowGroup().start);
+	UncompressedCompressState::CreateEmptySegment(checkpointer.GetStartRow());
 }
 
 void UncompressedCompressState::CreateEmptySegment(idx_t row_start) {
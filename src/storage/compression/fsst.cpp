@@ -205,7 +205,7 @@ public:
 	FSSTCompressionState(ColumnDataCheckpointer &checkpointer, const CompressionInfo &info)
 	    : CompressionState(info), checkpointer(checkpointer),
 	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_FSST)) {
-		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		CreateEmptySegment(checkpointer.GetStartRow());
 	}
 
 	~FSSTCompressionState() override {
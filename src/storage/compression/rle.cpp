@@ -137,7 +137,7 @@ struct RLECompressState : public CompressionState {
 	RLECompressState(ColumnDataCheckpointer &checkpointer_p, const CompressionInfo &info)
 	    : CompressionState(info), checkpointer(checkpointer_p),
 	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_RLE)) {
-		CreateEmptySegment(checkpointer.GetRowGroup().start);
+		CreateEmptySegment(checkpointer.GetStartRow());
 
 		state.dataptr = (void *)this;
 		max_rle_count = MaxRLECount();
@@ -374,6 +374,63 @@ void RLEScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, V
 	RLEScanPartialInternal<T, true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void RLEFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+               SelectionVector &sel, idx_t &sel_count, const TableFilter &filter) {
+	D_ASSERT(vector_count <= STANDARD_VECTOR_SIZE);
+	auto &scan_state = state.scan_state->Cast<RLEScanState<T>>();
+
+	auto data = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto data_pointer = reinterpret_cast<T *>(data + RLEConstants::RLE_HEADER_SIZE);
+	auto index_pointer = reinterpret_cast<rle_count_t *>(data + scan_state.rle_count_offset);
+
+	// gather the runs that overlap with this vector
+	Vector run_values(segment.type, vector_count);
+	auto run_data = FlatVector::GetData<T>(run_values);
+	idx_t run_ends[STANDARD_VECTOR_SIZE];
+	idx_t run_count = 0;
+	auto entry_pos = scan_state.entry_pos;
+	auto position_in_entry = scan_state.position_in_entry;
+	for (idx_t position = 0; position < vector_count;) {
+		auto run_length = MinValue<idx_t>(index_pointer[entry_pos] - position_in_entry, vector_count - position);
+		run_data[run_count] = data_pointer[entry_pos];
+		position += run_length;
+		run_ends[run_count++] = position;
+		entry_pos++;
+		position_in_entry = 0;
+	}
+
+	// scan the values
+	RLEScan<T>(segment, state, vector_count, result);
+	if (sel_count == 0) {
+		return;
+	}
+
+	// evaluate the filter once per run
+	bool run_matches[STANDARD_VECTOR_SIZE];
+	ColumnSegment::FilterValues(run_values, run_count, filter, run_matches);
+	bool row_matches[STANDARD_VECTOR_SIZE];
+	idx_t run_start = 0;
+	idx_t matching_runs = 0;
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		memset(row_matches + run_start, run_matches[run_idx], run_ends[run_idx] - run_start);
+		run_start = run_ends[run_idx];
+		matching_runs += run_matches[run_idx];
+	}
+	if (matching_runs == run_count) {
+		// all rows pass the filter
+		return;
+	}
+	if (matching_runs == 0) {
+		sel_count = 0;
+		return;
+	}
+	ColumnSegment::SelectMatches(sel, sel_count, row_matches);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -393,10 +450,12 @@ void RLEFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id,
 //===--------------------------------------------------------------------===//
 template <class T, bool WRITE_STATISTICS = true>
 CompressionFunction GetRLEFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
-	                           RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
-	                           RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
-	                           RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	CompressionFunction function(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
+	                             RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
+	                             RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
+	                             RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	function.filter = RLEFilter<T>;
+	return function;
 }
 
 CompressionFunction RLEFun::GetFunction(PhysicalType type) {
@@ -53,7 +53,8 @@ void StandardBufferManager::SetTemporaryDirectory(const string &new_dir) {
 StandardBufferManager::StandardBufferManager(DatabaseInstance &db, string tmp)
     : BufferManager(), db(db), buffer_pool(db.GetBufferPool()), temporary_id(MAXIMUM_BLOCK),
       buffer_allocator(BufferAllocatorAllocate, BufferAllocatorFree, BufferAllocatorRealloc,
-                       make_uniq<BufferAllocatorData>(*this)) {
+                       make_uniq<BufferAllocatorData>(*this)),
+      prefetched_blocks(0) {
 	temp_block_manager = make_uniq<InMemoryBlockManager>(*this, DEFAULT_BLOCK_ALLOC_SIZE);
 	temporary_directory.path = std::move(tmp);
 	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
@@ -103,6 +104,10 @@ idx_t StandardBufferManager::GetBlockSize() const {
 	return temp_block_manager->GetBlockSize();
 }
 
+idx_t StandardBufferManager::GetPrefetchedBlockCount() const {
+	return prefetched_blocks;
+}
+
 template <typename... ARGS>
 TempBufferPoolReservation StandardBufferManager::EvictBlocksOrThrow(MemoryTag tag, idx_t memory_delta,
                                                                     unique_ptr<FileBuffer> *buffer, ARGS... args) {
@@ -253,8 +258,11 @@ void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles,
 			    intermediate_buffer.GetFileBuffer().InternalBuffer() + block_idx * block_manager.GetBlockAllocSize();
 			buf = BlockHandle::LoadFromBuffer(handle, block_ptr, std::move(reusable_buffer));
 			handle->readers = 1;
+			handle->prefetched = true;
+			handle->accessed = buffer_pool.RemoveFromGhostQueue(*handle);
 			handle->memory_charge = std::move(reservation);
 		}
+		prefetched_blocks++;
 	}
 }
 
@@ -311,6 +319,8 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// check if the block is already loaded
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and set the BufferHandle
+			buffer_pool.RegisterQueueHit(*handle);
+			handle->RegisterReuse();
 			handle->readers++;
 			buf = handle->Load(handle);
 		}
@@ -318,6 +328,7 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	}
 
 	if (buf.IsValid()) {
+		buffer_pool.RegisterPin(handle->tag, true);
 		return buf; // the block was already loaded, return it without holding the BlockHandle's lock
 	} else {
 		// evict blocks until we have space for the current block
@@ -331,14 +342,21 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// check if the block is already loaded
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
+			buffer_pool.RegisterQueueHit(*handle);
+			handle->RegisterReuse();
 			handle->readers++;
 			reservation.Resize(0);
 			buf = handle->Load(handle);
+			buffer_pool.RegisterPin(handle->tag, true);
 		} else {
 			// now we can actually load the current block
 			D_ASSERT(handle->readers == 0);
+			buffer_pool.RegisterPin(handle->tag, false);
 			buf = handle->Load(handle, std::move(reusable_buffer));
 			handle->readers = 1;
+			handle->prefetched = false;
+			// a block that is loaded again shortly after it was evicted is re-used
+			handle->accessed = buffer_pool.RemoveFromGhostQueue(*handle);
 			handle->memory_charge = std::move(reservation);
 			// in the case of a variable sized block, the buffer may be smaller than a full block.
 			int64_t delta =
@@ -420,6 +438,9 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 		info.tag = MemoryTag(k);
 		info.size = buffer_pool.memory_usage.GetUsedMemory(MemoryTag(k), BufferPool::MemoryUsageCaches::FLUSH);
 		info.evicted_data = evicted_data_per_tag[k].load();
+		info.buffer_hits = buffer_pool.GetBufferHits(MemoryTag(k));
+		info.buffer_misses = buffer_pool.GetBufferMisses(MemoryTag(k));
+		info.evictions = buffer_pool.GetEvictions(MemoryTag(k));
 		result.push_back(info);
 	}
 	return result;
@@ -564,6 +585,9 @@ vector<TemporaryFileInformation> StandardBufferManager::GetTemporaryFiles() {
 		TemporaryFileInformation info;
 		info.path = name;
 		info.size = NumericCast<idx_t>(fs.GetFileSize(*handle));
+		info.slot_size = info.size;
+		info.block_count = 1;
+		info.uncompressed_size = info.size;
 		handle.reset();
 		result.push_back(info);
 	});
@@ -219,13 +219,22 @@ void SingleFileStorageManager::LoadDatabase(const optional_idx block_alloc_size)
 		auto handle = fs.OpenFile(wal_path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
 		if (handle) {
 			// replay the WAL
-			if (WriteAheadLog::Replay(db, std::move(handle))) {
+			if (WriteAheadLog::Replay(db, std::move(handle), wal_replay_statistics)) {
 				fs.RemoveFile(wal_path);
 			}
 		}
 	}
 
 	load_complete = true;
+
+	if (config.options.checkpoint_on_wal_replay && wal_replay_statistics.transactions > 0 && !read_only) {
+		// checkpoint the replayed state right away, so that the WAL does not have to be replayed again
+		CheckpointOptions checkpoint_options;
+		checkpoint_options.wal_action = CheckpointWALAction::DELETE_WAL;
+		checkpoint_options.action = CheckpointAction::ALWAYS_CHECKPOINT;
+		CreateCheckpoint(checkpoint_options);
+		wal_replay_statistics.checkpointed = true;
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -251,6 +260,8 @@ public:
 	void RevertCommit() override;
 	// Make the commit persistent
 	void FlushCommit() override;
+	bool HasPendingSync() override;
+	void SyncCommit() override;
 
 	void AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
 	                     unique_ptr<PersistentCollectionData> row_group_data) override;
@@ -262,11 +273,20 @@ private:
 	idx_t initial_written = 0;
 	WriteAheadLog &wal;
 	WALCommitState state;
+	//! Whether the commit is synced together with other concurrent commits
+	bool group_commit;
+	//! How long (in microseconds) a group commit waits for other commits to join before syncing the WAL
+	idx_t group_commit_delay;
+	//! The sequence number of the commit in the WAL, if it still has to be synced
+	idx_t commit_sequence = 0;
 	reference_map_t<DataTable, unordered_map<idx_t, OptimisticallyWrittenRowGroupData>> optimistically_written_data;
 };
 
 SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &storage, WriteAheadLog &wal)
     : wal(wal), state(WALCommitState::IN_PROGRESS) {
+	auto &config = DBConfig::Get(storage.GetAttached());
+	group_commit = config.options.wal_group_commit;
+	group_commit_delay = config.options.wal_group_commit_delay;
 	auto initial_size = storage.GetWALSize();
 	initial_written = wal.GetTotalWritten();
 	initial_wal_size = initial_size;
@@ -298,10 +318,27 @@ void SingleFileStorageCommitState::FlushCommit() {
 	if (state != WALCommitState::IN_PROGRESS) {
 		return;
 	}
-	wal.Flush();
+	if (group_commit) {
+		// write the commit to the WAL - the WAL is synced later on, together with other concurrent commits
+		commit_sequence = wal.WriteCommit();
+	} else {
+		wal.FlushCommit();
+	}
 	state = WALCommitState::FLUSHED;
 }
 
+bool SingleFileStorageCommitState::HasPendingSync() {
+	return commit_sequence > 0;
+}
+
+void SingleFileStorageCommitState::SyncCommit() {
+	if (commit_sequence == 0) {
+		return;
+	}
+	wal.SyncCommit(commit_sequence, group_commit_delay);
+	commit_sequence = 0;
+}
+
 void SingleFileStorageCommitState::AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
                                                    unique_ptr<PersistentCollectionData> row_group_data) {
 	auto &entries = optimistically_written_data[table];
@@ -188,6 +188,38 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 	return initial_remaining - remaining;
 }
 
+bool ColumnData::CanFilterVector(ColumnScanState &state, const TableFilter &filter, idx_t scan_count) {
+	if (!state.current || (state.scan_options && state.scan_options->force_fetch_row)) {
+		return false;
+	}
+	if (GetVectorScanType(state, scan_count) != ScanVectorType::SCAN_ENTIRE_VECTOR) {
+		// there are updates, or the vector crosses a segment boundary
+		return false;
+	}
+	return state.current->SupportsFilter(filter);
+}
+
+idx_t ColumnData::FilterVector(ColumnScanState &state, Vector &result, idx_t scan_count, SelectionVector &sel,
+                               idx_t &sel_count, const TableFilter &filter) {
+	state.previous_states.clear();
+	if (!state.initialized) {
+		D_ASSERT(state.current);
+		state.current->InitializeScan(state);
+		state.internal_index = state.current->start;
+		state.initialized = true;
+	}
+	D_ASSERT(data.HasSegment(state.current));
+	D_ASSERT(state.internal_index <= state.row_index);
+	if (state.internal_index < state.row_index) {
+		state.current->Skip(state);
+	}
+	D_ASSERT(state.row_index + scan_count <= state.current->start + state.current->count);
+	state.current->Filter(state, scan_count, result, sel, sel_count, filter);
+	state.row_index += scan_count;
+	state.internal_index = state.row_index;
+	return scan_count;
+}
+
 unique_ptr<BaseStatistics> ColumnData::GetUpdateStatistics() {
 	lock_guard<mutex> update_guard(update_lock);
 	return updates ? updates->GetStatistics() : nullptr;
@@ -12,7 +12,7 @@ ColumnDataCheckpointer::ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup
     : col_data(col_data_p), row_group(row_group_p), state(state_p),
       is_validity(GetType().id() == LogicalTypeId::VALIDITY),
       intermediate(is_validity ? LogicalType::BOOLEAN : GetType(), true, is_validity),
-      checkpoint_info(checkpoint_info_p) {
+      start_row(row_group_p.start), checkpoint_info(checkpoint_info_p) {
 
 	auto &config = DBConfig::GetConfig(GetDatabase());
 	auto functions = config.GetCompressionFunctions(GetType().InternalType());
@@ -37,6 +37,10 @@ RowGroup &ColumnDataCheckpointer::GetRowGroup() {
 	return row_group;
 }
 
+idx_t ColumnDataCheckpointer::GetStartRow() const {
+	return start_row;
+}
+
 ColumnCheckpointState &ColumnDataCheckpointer::GetCheckpointState() {
 	return state;
 }
@@ -205,28 +209,56 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	nodes.clear();
 }
 
+bool ColumnDataCheckpointer::HasChanges(ColumnSegment &segment) {
+	if (segment.segment_type == ColumnSegmentType::TRANSIENT) {
+		// transient segment: always need to write to disk
+		return true;
+	}
+	// persistent segment; check if there were any updates or deletions in this segment
+	idx_t start_row_idx = segment.start - row_group.start;
+	idx_t end_row_idx = start_row_idx + segment.count;
+	return col_data.updates && col_data.updates->HasUpdates(start_row_idx, end_row_idx);
+}
+
 bool ColumnDataCheckpointer::HasChanges() {
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
-		auto segment = nodes[segment_idx].node.get();
-		if (segment->segment_type == ColumnSegmentType::TRANSIENT) {
-			// transient segment: always need to write to disk
+		if (HasChanges(*nodes[segment_idx].node)) {
 			return true;
-		} else {
-			// persistent segment; check if there were any updates or deletions in this segment
-			idx_t start_row_idx = segment->start - row_group.start;
-			idx_t end_row_idx = start_row_idx + segment->count;
-			if (col_data.updates && col_data.updates->HasUpdates(start_row_idx, end_row_idx)) {
-				return true;
-			}
 		}
 	}
 	return false;
 }
 
-void ColumnDataCheckpointer::WritePersistentSegments() {
-	// all segments are persistent and there are no updates
+idx_t ColumnDataCheckpointer::GetReusableSegmentCount() {
+	auto &config = DBConfig::GetConfig(GetDatabase());
+	if (!config.options.incremental_checkpoint) {
+		return 0;
+	}
+	if (checkpoint_info.GetCompressionType() != CompressionType::COMPRESSION_AUTO ||
+	    config.options.force_compression != CompressionType::COMPRESSION_AUTO) {
+		// a forced compression method applies to all segments of the column - rewrite all of them
+		return 0;
+	}
+	// the leading persistent segments without changes can be kept as-is
+	// only the segments starting from the first change (e.g. updates or appended data) are rewritten
+	idx_t segment_count = 0;
+	for (; segment_count < nodes.size(); segment_count++) {
+		if (HasChanges(*nodes[segment_count].node)) {
+			break;
+		}
+	}
+	// the segments before the last kept segment were closed because they were full
+	// the last kept segment might not be: rewrite it together with the changes if it is small
+	if (segment_count > 0 && nodes[segment_count - 1].node->count < MINIMUM_REUSE_COUNT) {
+		segment_count--;
+	}
+	return segment_count;
+}
+
+void ColumnDataCheckpointer::WritePersistentSegments(idx_t segment_count) {
+	// these segments are persistent and there are no updates
 	// we only need to write the metadata
-	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
+	for (idx_t segment_idx = 0; segment_idx < segment_count; segment_idx++) {
 		auto segment = nodes[segment_idx].node.get();
 		auto pointer = segment->GetDataPointer();
 
@@ -246,11 +278,17 @@ void ColumnDataCheckpointer::Checkpoint(vector<SegmentNode<ColumnSegment>> nodes
 	// first check if any of the segments have changes
 	if (!HasChanges()) {
 		// no changes: only need to write the metadata for this column
-		WritePersistentSegments();
-	} else {
-		// there are changes: rewrite the set of columns);
-		WriteToDisk();
+		WritePersistentSegments(nodes.size());
+		return;
+	}
+	// there are changes: keep the unchanged leading segments, and rewrite the remaining segments
+	auto reuse_count = GetReusableSegmentCount();
+	if (reuse_count > 0) {
+		WritePersistentSegments(reuse_count);
+		nodes.erase(nodes.begin(), nodes.begin() + NumericCast<int64_t>(reuse_count));
+		start_row = nodes[0].node->start;
 	}
+	WriteToDisk();
 }
 
 CompressionFunction &ColumnDataCheckpointer::GetCompressionFunction(CompressionType compression_type) {
@@ -4,8 +4,11 @@
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/storage_manager.hpp"
@@ -139,6 +142,82 @@ void ColumnSegment::ScanPartial(ColumnScanState &state, idx_t scan_count, Vector
 	function.get().scan_partial(*this, state, scan_count, result, result_offset);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+bool ColumnSegment::SupportsFilter(const TableFilter &filter) const {
+	return function.get().filter && IsValueFilter(filter);
+}
+
+void ColumnSegment::Filter(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+                           idx_t &sel_count, const TableFilter &filter) {
+	D_ASSERT(SupportsFilter(filter));
+	function.get().filter(*this, state, scan_count, result, sel, sel_count, filter);
+}
+
+bool ColumnSegment::IsValueFilter(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IN_FILTER:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!IsValueFilter(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!IsValueFilter(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		// NULL filters depend on the validity, and bloom and dynamic filters can change while scanning
+		return false;
+	}
+}
+
+void ColumnSegment::FilterValues(Vector &values, idx_t count, const TableFilter &filter, bool *matches) {
+	D_ASSERT(IsValueFilter(filter));
+	memset(matches, 0, count * sizeof(bool));
+	for (idx_t offset = 0; offset < count; offset += STANDARD_VECTOR_SIZE) {
+		auto filter_count = MinValue<idx_t>(count - offset, STANDARD_VECTOR_SIZE);
+		Vector slice(values, offset, offset + filter_count);
+		UnifiedVectorFormat vdata;
+		slice.ToUnifiedFormat(filter_count, vdata);
+
+		SelectionVector sel(filter_count);
+		for (idx_t i = 0; i < filter_count; i++) {
+			sel.set_index(i, i);
+		}
+		idx_t approved_count = filter_count;
+		FilterSelection(sel, slice, vdata, filter, filter_count, approved_count);
+		for (idx_t i = 0; i < approved_count; i++) {
+			matches[offset + sel.get_index(i)] = true;
+		}
+	}
+}
+
+void ColumnSegment::SelectMatches(SelectionVector &sel, idx_t &sel_count, const bool *row_matches) {
+	// "sel" can point to a selection vector that is shared with the scan state: write the result to a new vector
+	SelectionVector new_sel(sel_count);
+	idx_t approved_count = 0;
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto idx = sel.get_index(i);
+		new_sel.set_index(approved_count, idx);
+		approved_count += row_matches[idx];
+	}
+	sel.Initialize(new_sel);
+	sel_count = approved_count;
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -521,6 +600,24 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		return TemplatedNullSelection<true>(vdata, sel, approved_tuple_count);
 	case TableFilterType::IS_NOT_NULL:
 		return TemplatedNullSelection<false>(vdata, sel, approved_tuple_count);
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		return in_filter.Filter(vector, vdata, sel, approved_tuple_count);
+	}
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomFilter>();
+		return bloom_filter.Filter(vector, vdata, sel, approved_tuple_count);
+	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		lock_guard<mutex> guard(dynamic_filter.filter_data->lock);
+		if (!dynamic_filter.filter_data->initialized) {
+			// the filter has not been set yet - everything passes
+			return approved_tuple_count;
+		}
+		return FilterSelection(sel, vector, vdata, *dynamic_filter.filter_data->filter, scan_count,
+		                       approved_tuple_count);
+	}
 	case TableFilterType::STRUCT_EXTRACT: {
 		auto &struct_filter = filter.Cast<StructFilter>();
 		// Apply the filter on the child vector
@@ -2,6 +2,7 @@
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/storage/table/column_data.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
@@ -22,6 +23,8 @@
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/execution/adaptive_filter.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/common/unordered_set.hpp"
 
 namespace duckdb {
 
@@ -197,6 +200,8 @@ bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector
 
 	state.row_group = this;
 	state.vector_index = vector_offset;
+	state.prefetch_row = vector_offset * STANDARD_VECTOR_SIZE;
+	state.ReleasePrefetchedBlocks();
 	state.max_row_group_row =
 	    this->start > state.max_row ? 0 : MinValue<idx_t>(this->count, state.max_row - this->start);
 	auto row_number = start + vector_offset * STANDARD_VECTOR_SIZE;
@@ -226,6 +231,8 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 	}
 	state.row_group = this;
 	state.vector_index = 0;
+	state.prefetch_row = 0;
+	state.ReleasePrefetchedBlocks();
 	state.max_row_group_row =
 	    this->start > state.max_row ? 0 : MinValue<idx_t>(this->count, state.max_row - this->start);
 	if (state.max_row_group_row == 0) {
@@ -371,6 +378,26 @@ void RowGroup::NextVector(CollectionScanState &state) {
 	}
 }
 
+//! Check a filter on the row id against the row ids in the range [start, end)
+static FilterPropagateResult CheckRowIdZonemap(TableFilter &filter, idx_t start, idx_t end) {
+	D_ASSERT(start < end);
+	auto stats = NumericStats::CreateEmpty(LogicalType::ROW_TYPE);
+	NumericStats::SetMin(stats, Value::BIGINT(UnsafeNumericCast<int64_t>(start)));
+	NumericStats::SetMax(stats, Value::BIGINT(UnsafeNumericCast<int64_t>(end - 1)));
+	stats.Set(StatsInfo::CANNOT_HAVE_NULL_VALUES);
+	return filter.CheckStatistics(stats);
+}
+
+//! Write the row ids of the rows [start, start + count) to a flat vector
+static void ScanRowIds(Vector &result, idx_t start, idx_t count) {
+	D_ASSERT(result.GetType().InternalType() == ROW_TYPE);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<int64_t>(result);
+	for (idx_t i = 0; i < count; i++) {
+		result_data[i] = UnsafeNumericCast<int64_t>(start + i);
+	}
+}
+
 bool RowGroup::CheckZonemap(ScanFilterInfo &filters) {
 	auto &filter_list = filters.GetFilterList();
 	// new row group - label all filters as up for grabs again
@@ -379,7 +406,12 @@ bool RowGroup::CheckZonemap(ScanFilterInfo &filters) {
 		auto &entry = filter_list[i];
 		auto &filter = entry.filter;
 		auto base_column_index = entry.table_column_index;
-		auto prune_result = GetColumn(base_column_index).CheckZonemap(filter);
+		FilterPropagateResult prune_result;
+		if (base_column_index == COLUMN_IDENTIFIER_ROW_ID) {
+			prune_result = CheckRowIdZonemap(filter, this->start, this->start + this->count);
+		} else {
+			prune_result = GetColumn(base_column_index).CheckZonemap(filter);
+		}
 		if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
 			return false;
 		}
@@ -419,6 +451,9 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::BLOOM_FILTER:
+	case TableFilterType::IN_FILTER:
+	case TableFilterType::DYNAMIC_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -437,6 +472,19 @@ bool RowGroup::CheckZonemapSegments(CollectionScanState &state) {
 		auto base_column_idx = entry.table_column_index;
 		auto &filter = entry.filter;
 
+		if (base_column_idx == COLUMN_IDENTIFIER_ROW_ID) {
+			// the row ids of the current vector are known up front: skip the vector if none of them can match
+			auto vector_start = this->start + state.vector_index * STANDARD_VECTOR_SIZE;
+			auto vector_count =
+			    MinValue<idx_t>(STANDARD_VECTOR_SIZE, state.max_row_group_row - state.vector_index * STANDARD_VECTOR_SIZE);
+			if (CheckRowIdZonemap(filter, vector_start, vector_start + vector_count) ==
+			    FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				NextVector(state);
+				return false;
+			}
+			continue;
+		}
+
 		auto prune_result = GetColumn(base_column_idx).CheckZonemap(state.column_scans[column_idx], filter);
 		if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
 			continue;
@@ -467,6 +515,74 @@ bool RowGroup::CheckZonemapSegments(CollectionScanState &state) {
 	return true;
 }
 
+void RowGroup::CollectPrefetchBlocks(CollectionScanState &state, PrefetchState &prefetch_state, idx_t count) {
+	const auto &column_ids = state.GetColumnIds();
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		const auto &column = column_ids[i];
+		if (column != COLUMN_IDENTIFIER_ROW_ID) {
+			GetColumn(column).InitializePrefetch(prefetch_state, state.column_scans[i], count);
+		}
+	}
+}
+
+void RowGroup::Prefetch(CollectionScanState &state, idx_t current_row) {
+	auto &block_manager = GetBlockManager();
+	if (block_manager.InMemory()) {
+		return;
+	}
+	auto &db = GetCollection().GetAttached().GetDatabase();
+	auto prefetch_depth = DBConfig::GetConfig(db).options.scan_prefetch_depth;
+#ifndef DUCKDB_ALTERNATIVE_VERIFY
+	// in regular operation we only prefetch the current vector from remote file systems
+	// when alternative verify is set, we always prefetch for testing purposes
+	if (prefetch_depth == 0 && !block_manager.IsRemote()) {
+		return;
+	}
+#endif
+	// the blocks of this window were read ahead in the background - wait for that to finish
+	// we keep them pinned until they are pinned for this window below
+	state.FinishReadAhead();
+	auto read_ahead_handles = std::move(state.read_ahead_handles);
+	state.read_ahead_handles.clear();
+	// release the pins of the previous window - the scan has moved past it
+	state.prefetch_handles.clear();
+
+	// collect the blocks of the next "prefetch_depth" vectors for all columns we are scanning
+	auto window_size = MaxValue<idx_t>(prefetch_depth, 1) * STANDARD_VECTOR_SIZE;
+	auto remaining_rows = state.max_row_group_row - current_row;
+	auto prefetch_count = MinValue<idx_t>(window_size, remaining_rows);
+	PrefetchState prefetch_state;
+	CollectPrefetchBlocks(state, prefetch_state, prefetch_count);
+	// read the blocks using batched reads of adjacent blocks
+	auto &buffer_manager = block_manager.buffer_manager;
+	buffer_manager.Prefetch(prefetch_state.blocks);
+	state.prefetch_row = current_row + prefetch_count;
+	if (prefetch_depth <= 1) {
+		return;
+	}
+	// keep the blocks pinned until the scan reaches them so they are not evicted in the meantime
+	unordered_set<BlockHandle *> window_blocks;
+	for (auto &block : prefetch_state.blocks) {
+		state.prefetch_handles.push_back(buffer_manager.Pin(block));
+		window_blocks.insert(block.get());
+	}
+	if (remaining_rows <= prefetch_count) {
+		return;
+	}
+	// read ahead the blocks of the next window in the background, while the scan processes this window
+	PrefetchState read_ahead_state;
+	CollectPrefetchBlocks(state, read_ahead_state, MinValue<idx_t>(2 * window_size, remaining_rows));
+	vector<shared_ptr<BlockHandle>> read_ahead_blocks;
+	for (auto &block : read_ahead_state.blocks) {
+		if (window_blocks.insert(block.get()).second) {
+			read_ahead_blocks.push_back(std::move(block));
+		}
+	}
+	if (!read_ahead_blocks.empty()) {
+		state.ScheduleReadAhead(TaskScheduler::GetScheduler(db), buffer_manager, std::move(read_ahead_blocks));
+	}
+}
+
 template <TableScanType TYPE>
 void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &state, DataChunk &result) {
 	const bool ALLOW_UPDATES = TYPE != TableScanType::TABLE_SCAN_COMMITTED_ROWS_DISALLOW_UPDATES &&
@@ -506,24 +622,8 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 		} else {
 			count = max_count;
 		}
-		auto &block_manager = GetBlockManager();
-#ifndef DUCKDB_ALTERNATIVE_VERIFY
-		// // in regular operation we only prefetch from remote file systems
-		// // when alternative verify is set, we always prefetch for testing purposes
-		if (block_manager.IsRemote())
-#else
-		if (!block_manager.InMemory())
-#endif
-		{
-			PrefetchState prefetch_state;
-			for (idx_t i = 0; i < column_ids.size(); i++) {
-				const auto &column = column_ids[i];
-				if (column != COLUMN_IDENTIFIER_ROW_ID) {
-					GetColumn(column).InitializePrefetch(prefetch_state, state.column_scans[i], max_count);
-				}
-			}
-			auto &buffer_manager = block_manager.buffer_manager;
-			buffer_manager.Prefetch(prefetch_state.blocks);
+		if (current_row + max_count > state.prefetch_row) {
+			Prefetch(state, current_row);
 		}
 
 		bool has_filters = filter_info.HasFilters();
@@ -569,6 +669,15 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 						continue;
 					}
 					auto scan_idx = filter.scan_column_index;
+					if (filter.table_column_index == COLUMN_IDENTIFIER_ROW_ID) {
+						auto &row_ids = result.data[scan_idx];
+						ScanRowIds(row_ids, this->start + current_row, max_count);
+						UnifiedVectorFormat vdata;
+						row_ids.ToUnifiedFormat(max_count, vdata);
+						ColumnSegment::FilterSelection(sel, row_ids, vdata, filter.filter, max_count,
+						                               approved_tuple_count);
+						continue;
+					}
 					auto &col_data = GetColumn(filter.table_column_index);
 					col_data.Select(transaction, state.vector_index, state.column_scans[scan_idx],
 					                result.data[scan_idx], sel, approved_tuple_count, filter.filter);
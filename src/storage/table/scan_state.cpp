@@ -1,6 +1,8 @@
 #include "duckdb/storage/table/scan_state.hpp"
 
 #include "duckdb/execution/adaptive_filter.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/table/column_data.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/table/row_group.hpp"
@@ -14,6 +16,9 @@ TableScanState::TableScanState() : table_state(*this), local_state(*this) {
 }
 
 TableScanState::~TableScanState() {
+	// the read-ahead tasks read from the database file - wait for them before the checkpoint lock is released
+	table_state.FinishReadAhead();
+	local_state.FinishReadAhead();
 }
 
 void TableScanState::Initialize(vector<column_t> column_ids_p, optional_ptr<TableFilterSet> table_filters) {
@@ -153,7 +158,63 @@ ParallelCollectionScanState::ParallelCollectionScanState()
 
 CollectionScanState::CollectionScanState(TableScanState &parent_p)
     : row_group(nullptr), vector_index(0), max_row_group_row(0), row_groups(nullptr), max_row(0), batch_index(0),
-      valid_sel(STANDARD_VECTOR_SIZE), parent(parent_p) {
+      valid_sel(STANDARD_VECTOR_SIZE), prefetch_row(0), parent(parent_p) {
+}
+
+CollectionScanState::~CollectionScanState() {
+	FinishReadAhead();
+}
+
+class ReadAheadTask : public BaseExecutorTask {
+public:
+	ReadAheadTask(TaskExecutor &executor, BufferManager &buffer_manager, vector<shared_ptr<BlockHandle>> blocks_p,
+	              vector<BufferHandle> &handles)
+	    : BaseExecutorTask(executor), buffer_manager(buffer_manager), blocks(std::move(blocks_p)), handles(handles) {
+	}
+
+	void ExecuteTask() override {
+		// read the blocks using batched reads of adjacent blocks, and keep them pinned until the scan reaches them
+		buffer_manager.Prefetch(blocks);
+		for (auto &block : blocks) {
+			handles.push_back(buffer_manager.Pin(block));
+		}
+	}
+
+private:
+	BufferManager &buffer_manager;
+	vector<shared_ptr<BlockHandle>> blocks;
+	vector<BufferHandle> &handles;
+};
+
+void CollectionScanState::ScheduleReadAhead(TaskScheduler &scheduler, BufferManager &buffer_manager,
+                                            vector<shared_ptr<BlockHandle>> blocks) {
+	D_ASSERT(read_ahead_handles.empty());
+	if (!read_ahead_executor) {
+		read_ahead_executor = make_uniq<TaskExecutor>(scheduler);
+	}
+	auto task =
+	    make_uniq<ReadAheadTask>(*read_ahead_executor, buffer_manager, std::move(blocks), read_ahead_handles);
+	read_ahead_executor->ScheduleTask(std::move(task));
+}
+
+void CollectionScanState::FinishReadAhead() {
+	if (!read_ahead_executor) {
+		return;
+	}
+	// if no thread has picked up the read-ahead yet we run it ourselves
+	try {
+		read_ahead_executor->WorkOnTasks();
+	} catch (std::exception &) {
+		// the read-ahead is only a performance hint - the scan loads the blocks (and reports any errors) itself
+		read_ahead_handles.clear();
+		read_ahead_executor.reset();
+	}
+}
+
+void CollectionScanState::ReleasePrefetchedBlocks() {
+	FinishReadAhead();
+	read_ahead_handles.clear();
+	prefetch_handles.clear();
 }
 
 bool CollectionScanState::Scan(DuckTransaction &transaction, DataChunk &result) {
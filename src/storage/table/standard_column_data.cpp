@@ -4,6 +4,7 @@
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
@@ -76,6 +77,28 @@ idx_t StandardColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_
 	return scan_count;
 }
 
+void StandardColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
+                                Vector &result, SelectionVector &sel, idx_t &count, const TableFilter &filter) {
+	auto target_count = GetVectorCount(vector_index);
+	if (!CanFilterVector(state, filter, target_count)) {
+		ColumnData::Select(transaction, vector_index, state, result, sel, count, filter);
+		return;
+	}
+	// evaluate the filter directly on the compressed values
+	auto scan_count = FilterVector(state, result, target_count, sel, count, filter);
+	validity.Scan(transaction, vector_index, state.child_states[0], result, target_count);
+	if (count == 0) {
+		return;
+	}
+	// the filter rejects NULL values: remove the rows that are NULL
+	UnifiedVectorFormat vdata;
+	result.ToUnifiedFormat(scan_count, vdata);
+	if (!vdata.validity.AllValid()) {
+		IsNotNullFilter not_null_filter;
+		ColumnSegment::FilterSelection(sel, result, vdata, not_null_filter, scan_count, count);
+	}
+}
+
 void StandardColumnData::InitializeAppend(ColumnAppendState &state) {
 	ColumnData::InitializeAppend(state);
 	ColumnAppendState child_append;
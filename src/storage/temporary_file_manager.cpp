@@ -1,17 +1,21 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
 
+#include "lz4.hpp"
+
 namespace duckdb {
 
 //===--------------------------------------------------------------------===//
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t slot_size)
+    : max_index(0), slot_size(slot_size), manager(&manager) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), slot_size(0), manager(nullptr) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -57,8 +61,11 @@ bool BlockIndexManager::HasFreeBlocks() {
 	return !free_indexes.empty();
 }
 
+idx_t BlockIndexManager::GetBlockCount() {
+	return indexes_in_use.size();
+}
+
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMP_FILE_BLOCK_SIZE = DEFAULT_BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +73,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * slot_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * slot_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -95,10 +102,11 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 //===--------------------------------------------------------------------===//
 
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
+                                         idx_t index, idx_t slot_size, TemporaryFileManager &manager)
     : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
+      slot_size(slot_size),
       path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+      index_manager(manager, slot_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -120,14 +128,40 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
+	D_ASSERT(!IsCompressed());
 	buffer.Write(*handle, GetPositionInFile(index.block_index));
 }
 
+void TemporaryFileHandle::WriteTemporaryFile(data_ptr_t compressed_data, TemporaryFileIndex index) {
+	D_ASSERT(IsCompressed());
+	handle->Write(compressed_data, slot_size, GetPositionInFile(index.block_index));
+}
+
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(
-	    BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-	    BufferManager::GetBufferManager(db).GetBlockSize(), std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto position = GetPositionInFile(block_index);
+	if (!IsCompressed()) {
+		return StandardBufferManager::ReadTemporaryBufferInternal(
+		    buffer_manager, *handle, position, buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+	}
+	// read the slot: the compressed size followed by the compressed data
+	auto compressed_data = Allocator::Get(db).Allocate(slot_size);
+	handle->Read(compressed_data.get(), slot_size, position);
+	auto compressed_size = Load<idx_t>(compressed_data.get());
+	if (compressed_size > slot_size - sizeof(idx_t)) {
+		throw IOException("Corrupt temporary buffer in file \"%s\": compressed size exceeds the slot size", path);
+	}
+
+	// decompress it directly into the buffer
+	auto buffer = buffer_manager.ConstructManagedBuffer(buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+	auto decompressed_size = duckdb_lz4::LZ4_decompress_safe(
+	    const_char_ptr_cast(compressed_data.get() + sizeof(idx_t)), char_ptr_cast(buffer->InternalBuffer()),
+	    NumericCast<int>(compressed_size), NumericCast<int>(buffer->AllocSize()));
+	if (decompressed_size < 0 || NumericCast<idx_t>(decompressed_size) != buffer->AllocSize()) {
+		throw IOException("Failed to decompress temporary buffer in file \"%s\"", path);
+	}
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -155,9 +189,20 @@ TemporaryFileInformation TemporaryFileHandle::GetTemporaryFile() {
 	TemporaryFileInformation info;
 	info.path = path;
 	info.size = GetPositionInFile(index_manager.GetMaxIndex());
+	info.slot_size = slot_size;
+	info.block_count = index_manager.GetBlockCount();
+	info.uncompressed_size = info.block_count * BufferManager::GetBufferManager(db).GetBlockAllocSize();
 	return info;
 }
 
+idx_t TemporaryFileHandle::GetSlotSize() const {
+	return slot_size;
+}
+
+bool TemporaryFileHandle::IsCompressed() const {
+	return slot_size < BufferManager::GetBufferManager(db).GetBlockAllocSize();
+}
+
 void TemporaryFileHandle::CreateFileIfNotExists(TemporaryFileLock &) {
 	if (handle) {
 		return;
@@ -181,7 +226,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	return index * slot_size;
 }
 
 //===--------------------------------------------------------------------===//
@@ -277,17 +322,49 @@ TemporaryFileManager::~TemporaryFileManager() {
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
+idx_t TemporaryFileManager::CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_data) {
+	auto alloc_size = buffer.AllocSize();
+	auto compress_bound = NumericCast<idx_t>(duckdb_lz4::LZ4_compressBound(NumericCast<int>(alloc_size)));
+	compressed_data = Allocator::Get(db).Allocate(sizeof(idx_t) + compress_bound);
+	auto compressed_size = duckdb_lz4::LZ4_compress_default(
+	    const_char_ptr_cast(buffer.InternalBuffer()), char_ptr_cast(compressed_data.get() + sizeof(idx_t)),
+	    NumericCast<int>(alloc_size), NumericCast<int>(compress_bound));
+	if (compressed_size <= 0) {
+		return alloc_size;
+	}
+	auto slot_size = AlignValue<idx_t, COMPRESSED_SLOT_GRANULARITY>(sizeof(idx_t) + NumericCast<idx_t>(compressed_size));
+	if (slot_size >= alloc_size) {
+		// we would not save any space - write the buffer uncompressed
+		return alloc_size;
+	}
+	// prefix the compressed data with its size and zero-initialize the rest of the slot
+	Store<idx_t>(NumericCast<idx_t>(compressed_size), compressed_data.get());
+	auto used_size = sizeof(idx_t) + NumericCast<idx_t>(compressed_size);
+	memset(compressed_data.get() + used_size, 0, slot_size - used_size);
+	return slot_size;
+}
+
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
+	// if enabled, compress the buffer before taking the lock, files are grouped by the resulting slot size
+	AllocatedData compressed_data;
+	auto slot_size = buffer.AllocSize();
+	if (DBConfig::GetConfig(db).options.temp_file_compression) {
+		slot_size = CompressBuffer(buffer, compressed_data);
+	}
+
 	{
 		TemporaryManagerLock lock(manager_lock);
 		// first check if we can write to an open existing file
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -297,7 +374,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, slot_size, *this);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -308,7 +386,11 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	if (handle->IsCompressed()) {
+		handle->WriteTemporaryFile(compressed_data.get(), index);
+	} else {
+		handle->WriteTemporaryFile(buffer, index);
+	}
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
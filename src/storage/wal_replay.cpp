@@ -5,11 +5,13 @@
 #include "duckdb/catalog/catalog_entry/type_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
 #include "duckdb/common/checksum.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/common/printer.hpp"
 #include "duckdb/common/serializer/binary_deserializer.hpp"
 #include "duckdb/common/serializer/buffered_file_reader.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/index_type_set.hpp"
 #include "duckdb/main/attached_database.hpp"
@@ -17,6 +19,8 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
@@ -32,6 +36,23 @@
 
 namespace duckdb {
 
+//! The maximum (serialized) size of the inserts that are batched together before they are replayed
+static constexpr idx_t MAX_PENDING_INSERT_SIZE = 64ULL * 1024ULL * 1024ULL;
+
+//! An insert into a table that is replayed as part of a batch of inserts
+struct ReplayInsertEntry {
+	ReplayInsertEntry(TableCatalogEntry &table, unique_ptr<data_t[]> data_p, idx_t size)
+	    : table(table), data(std::move(data_p)), size(size) {
+	}
+
+	reference<TableCatalogEntry> table;
+	//! The serialized WAL entry
+	unique_ptr<data_t[]> data;
+	idx_t size;
+	//! The deserialized chunk
+	DataChunk chunk;
+};
+
 class ReplayState {
 public:
 	ReplayState(AttachedDatabase &db, ClientContext &context) : db(db), context(context), catalog(db.GetCatalog()) {
@@ -43,6 +64,21 @@ public:
 	optional_ptr<TableCatalogEntry> current_table;
 	MetaBlockPointer checkpoint_id;
 	idx_t wal_version = 1;
+
+	//! Whether or not inserts are replayed in parallel
+	bool parallel_inserts = false;
+	//! The inserts that have been read, but not yet replayed
+	vector<unique_ptr<ReplayInsertEntry>> pending_inserts;
+	//! The total size of the serialized pending inserts
+	idx_t pending_insert_size = 0;
+	//! The number of batches of inserts that were replayed
+	idx_t insert_batches = 0;
+	//! The maximum number of threads that replayed a batch of inserts
+	idx_t replay_threads = 0;
+
+public:
+	//! Replay the pending inserts
+	void ReplayInserts();
 };
 
 class WriteAheadLogDeserializer {
@@ -54,7 +90,7 @@ public:
 	WriteAheadLogDeserializer(ReplayState &state_p, unique_ptr<data_t[]> data_p, idx_t size,
 	                          bool deserialize_only = false)
 	    : state(state_p), db(state.db), context(state.context), catalog(state.catalog), data(std::move(data_p)),
-	      stream(data.get(), size), deserializer(stream), deserialize_only(deserialize_only) {
+	      size(size), stream(data.get(), size), deserializer(stream), deserialize_only(deserialize_only) {
 	}
 
 	static WriteAheadLogDeserializer Open(ReplayState &state_p, BufferedFileReader &stream,
@@ -111,6 +147,23 @@ public:
 		return deserialize_only;
 	}
 
+	//! Whether or not the entry has been read into a buffer
+	bool IsBuffered() const {
+		return data != nullptr;
+	}
+
+	//! Read the type of the entry without consuming it - only supported for entries that have been read into a buffer
+	WALType PeekEntryType() {
+		D_ASSERT(data);
+		MemoryStream peek_stream(data.get(), size);
+		BinaryDeserializer peek_deserializer(peek_stream);
+		peek_deserializer.Begin();
+		return peek_deserializer.ReadProperty<WALType>(100, "wal_type");
+	}
+
+	//! Add an insert entry to the pending inserts, instead of replaying it right away
+	void DeferInsert();
+
 protected:
 	void ReplayEntry(WALType wal_type);
 
@@ -155,6 +208,7 @@ private:
 	ClientContext &context;
 	Catalog &catalog;
 	unique_ptr<data_t[]> data;
+	idx_t size = 0;
 	MemoryStream stream;
 	BinaryDeserializer deserializer;
 	bool deserialize_only;
@@ -163,7 +217,8 @@ private:
 //===--------------------------------------------------------------------===//
 // Replay
 //===--------------------------------------------------------------------===//
-bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> handle) {
+bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> handle,
+                           WALReplayStatistics &statistics) {
 	Connection con(database.GetDatabase());
 	auto wal_path = handle->GetPath();
 	BufferedFileReader reader(FileSystem::Get(database), std::move(handle));
@@ -171,6 +226,9 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		// WAL is empty
 		return false;
 	}
+	Profiler profiler;
+	profiler.Start();
+	statistics.wal_size = reader.FileSize();
 
 	con.BeginTransaction();
 	MetaTransaction::Get(*con.context).ModifyDatabase(database);
@@ -210,6 +268,9 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 
 	// we need to recover from the WAL: actually set up the replay state
 	ReplayState state(database, *con.context);
+	// the entries of WAL files with checksums are read into a buffer before they are replayed
+	// this allows us to replay the inserts into tables in parallel
+	state.parallel_inserts = checkpoint_state.wal_version >= 2;
 
 	// reset the reader - we are going to read the WAL from the beginning again
 	reader.Reset();
@@ -221,8 +282,23 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		while (true) {
 			// read the current entry
 			auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
+			statistics.entries++;
+			// the WAL_VERSION entry at the start of the WAL is read before the version is known, so it is not buffered
+			if (state.parallel_inserts && deserializer.IsBuffered()) {
+				auto entry_type = deserializer.PeekEntryType();
+				if (entry_type == WALType::INSERT_TUPLE) {
+					deserializer.DeferInsert();
+					continue;
+				}
+				if (entry_type != WALType::USE_TABLE) {
+					// all other entries are replayed in order - replay the pending inserts first
+					state.ReplayInserts();
+				}
+			}
 			if (deserializer.ReplayEntry()) {
 				con.Commit();
+				statistics.transactions++;
+				statistics.replayed_bytes = reader.CurrentOffset();
 				// check if the file is exhausted
 				if (reader.Finished()) {
 					// we finished reading the file: break
@@ -247,9 +323,148 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		con.Query("ROLLBACK");
 		throw;
 	} // LCOV_EXCL_STOP
+	statistics.insert_batches = state.insert_batches;
+	statistics.replay_threads = state.replay_threads;
+	profiler.End();
+	statistics.replay_time_us = LossyNumericCast<idx_t>(profiler.Elapsed() * 1000000.0);
 	return false;
 }
 
+//===--------------------------------------------------------------------===//
+// Parallel Inserts
+//===--------------------------------------------------------------------===//
+//! Deserializes the chunks of a range of pending inserts
+class ReplayDeserializeInsertsTask : public BaseExecutorTask {
+public:
+	ReplayDeserializeInsertsTask(TaskExecutor &executor, vector<unique_ptr<ReplayInsertEntry>> &inserts,
+	                             idx_t start_idx, idx_t end_idx)
+	    : BaseExecutorTask(executor), inserts(inserts), start_idx(start_idx), end_idx(end_idx) {
+	}
+
+	void ExecuteTask() override {
+		for (idx_t i = start_idx; i < end_idx; i++) {
+			auto &insert = *inserts[i];
+			MemoryStream stream(insert.data.get(), insert.size);
+			BinaryDeserializer deserializer(stream);
+			deserializer.Begin();
+			auto wal_type = deserializer.ReadProperty<WALType>(100, "wal_type");
+			D_ASSERT(wal_type == WALType::INSERT_TUPLE);
+			(void)wal_type;
+			deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { insert.chunk.Deserialize(object); });
+			deserializer.End();
+			insert.data.reset();
+		}
+	}
+
+private:
+	vector<unique_ptr<ReplayInsertEntry>> &inserts;
+	idx_t start_idx;
+	idx_t end_idx;
+};
+
+//! Appends the deserialized chunks of the pending inserts into a single table, in the order they were written
+class ReplayAppendInsertsTask : public BaseExecutorTask {
+public:
+	ReplayAppendInsertsTask(TaskExecutor &executor, ClientContext &context,
+	                        vector<reference<ReplayInsertEntry>> inserts)
+	    : BaseExecutorTask(executor), context(context), inserts(std::move(inserts)) {
+	}
+
+	void ExecuteTask() override {
+		auto &table = inserts[0].get().table.get();
+		auto &storage = table.GetStorage();
+		// we don't do any constraint verification here
+		vector<unique_ptr<BoundConstraint>> bound_constraints;
+		LocalAppendState append_state;
+		storage.InitializeLocalAppend(append_state, table, context, bound_constraints);
+		for (auto &insert : inserts) {
+			storage.LocalAppend(append_state, table, context, insert.get().chunk);
+			insert.get().chunk.Destroy();
+		}
+		storage.FinalizeLocalAppend(append_state);
+	}
+
+private:
+	ClientContext &context;
+	vector<reference<ReplayInsertEntry>> inserts;
+};
+
+//! Works on the tasks of the executor on the current thread and on a set of worker threads, which only live for the
+//! duration of the call. The WAL of the main database is replayed before the threads of the TaskScheduler are
+//! launched, as these threads would also execute other tasks (e.g. of the checkpoint that follows the replay) that race
+//! with the catalog while the database is loaded. The workers only execute the tasks of this executor.
+static void WorkOnReplayTasks(TaskExecutor &executor, idx_t worker_count) {
+#ifndef DUCKDB_NO_THREADS
+	vector<thread> workers;
+	for (idx_t i = 0; i < worker_count; i++) {
+		workers.emplace_back([&executor]() {
+			shared_ptr<Task> task;
+			while (executor.GetTask(task)) {
+				TaskScheduler::ExecuteTask(*task, TaskExecutionMode::PROCESS_ALL);
+				task.reset();
+			}
+		});
+	}
+	try {
+		executor.WorkOnTasks();
+	} catch (...) {
+		for (auto &worker : workers) {
+			worker.join();
+		}
+		throw;
+	}
+	for (auto &worker : workers) {
+		worker.join();
+	}
+#else
+	executor.WorkOnTasks();
+#endif
+}
+
+void ReplayState::ReplayInserts() {
+	if (pending_inserts.empty()) {
+		return;
+	}
+	TaskExecutor executor(context);
+	// if the threads of the scheduler are not running yet, the inserts are replayed on workers of our own
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	auto &config = DBConfig::GetConfig(context);
+	auto scheduler_threads = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	auto thread_count = MaxValue<idx_t>(scheduler_threads, config.options.maximum_threads);
+
+	// deserialize the chunks in parallel
+	auto task_count = MinValue<idx_t>(thread_count, pending_inserts.size());
+	auto inserts_per_task = (pending_inserts.size() + task_count - 1) / task_count;
+	for (idx_t start_idx = 0; start_idx < pending_inserts.size(); start_idx += inserts_per_task) {
+		auto end_idx = MinValue<idx_t>(start_idx + inserts_per_task, pending_inserts.size());
+		executor.ScheduleTask(make_uniq<ReplayDeserializeInsertsTask>(executor, pending_inserts, start_idx, end_idx));
+	}
+	auto worker_count = MinValue<idx_t>(thread_count - scheduler_threads, task_count - 1);
+	WorkOnReplayTasks(executor, worker_count);
+	replay_threads = MaxValue<idx_t>(replay_threads, task_count);
+
+	// append the chunks of the different tables in parallel
+	// the chunks of a single table are appended in order by a single task, so that the row ids match the WAL
+	vector<vector<reference<ReplayInsertEntry>>> table_inserts;
+	reference_map_t<TableCatalogEntry, idx_t> table_indexes;
+	for (auto &insert : pending_inserts) {
+		auto entry = table_indexes.find(insert->table);
+		if (entry == table_indexes.end()) {
+			entry = table_indexes.insert(make_pair(insert->table, table_inserts.size())).first;
+			table_inserts.emplace_back();
+		}
+		table_inserts[entry->second].push_back(*insert);
+	}
+	for (auto &inserts : table_inserts) {
+		executor.ScheduleTask(make_uniq<ReplayAppendInsertsTask>(executor, context, std::move(inserts)));
+	}
+	WorkOnReplayTasks(executor, MinValue<idx_t>(thread_count - scheduler_threads, table_inserts.size() - 1));
+
+	pending_inserts.clear();
+	pending_insert_size = 0;
+	insert_batches++;
+}
+
 //===--------------------------------------------------------------------===//
 // Replay Entries
 //===--------------------------------------------------------------------===//
@@ -643,6 +858,19 @@ void WriteAheadLogDeserializer::ReplayUseTable() {
 	state.current_table = &catalog.GetEntry<TableCatalogEntry>(context, schema_name, table_name);
 }
 
+void WriteAheadLogDeserializer::DeferInsert() {
+	D_ASSERT(state.parallel_inserts && !DeserializeOnly());
+	if (!state.current_table) {
+		throw InternalException("Corrupt WAL: insert without table");
+	}
+	state.pending_insert_size += size;
+	state.pending_inserts.push_back(make_uniq<ReplayInsertEntry>(*state.current_table, std::move(data), size));
+	if (state.pending_insert_size >= MAX_PENDING_INSERT_SIZE) {
+		// limit the amount of memory used by the pending inserts
+		state.ReplayInserts();
+	}
+}
+
 void WriteAheadLogDeserializer::ReplayInsert() {
 	DataChunk chunk;
 	deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { chunk.Deserialize(object); });
@@ -14,15 +14,18 @@
 #include "duckdb/storage/table/data_table_info.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/common/checksum.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/storage/table/column_data.hpp"
 
+#include <thread>
+
 namespace duckdb {
 
 const uint64_t WAL_VERSION_NUMBER = 2;
 
 WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &wal_path)
-    : database(database), wal_path(wal_path), wal_size(0), initialized(false) {
+    : database(database), wal_path(wal_path), wal_size(0), initialized(false), written_commit_sequence(0) {
 }
 
 WriteAheadLog::~WriteAheadLog() {
@@ -423,4 +426,83 @@ void WriteAheadLog::Flush() {
 	wal_size = writer->GetFileSize();
 }
 
+void WriteAheadLog::FlushCommit() {
+	if (!writer) {
+		return;
+	}
+	Profiler profiler;
+	profiler.Start();
+	Flush();
+	profiler.End();
+
+	lock_guard<mutex> guard(commit_lock);
+	RecordSync(1, profiler.Elapsed());
+}
+
+idx_t WriteAheadLog::WriteCommit() {
+	if (!writer) {
+		return 0;
+	}
+	// write an empty entry
+	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
+	serializer.End();
+
+	// hand the commit to the OS - the sync happens in SyncCommit
+	writer->Flush();
+	wal_size = writer->GetFileSize();
+	return ++written_commit_sequence;
+}
+
+void WriteAheadLog::SyncCommit(idx_t commit_sequence, idx_t max_delay_us) {
+	unique_lock<mutex> guard(commit_lock);
+	while (synced_commit_sequence < commit_sequence) {
+		if (sync_in_progress) {
+			// another thread is syncing - wait for it to finish, the sync might include our commit
+			commit_cv.wait(guard);
+			continue;
+		}
+		// we sync the WAL for all commits that have been written so far
+		sync_in_progress = true;
+		guard.unlock();
+		if (max_delay_us > 0) {
+			// give concurrent commits the chance to join this sync
+			std::this_thread::sleep_for(std::chrono::microseconds(max_delay_us));
+		}
+		idx_t sync_sequence = written_commit_sequence;
+		Profiler profiler;
+		ErrorData error;
+		try {
+			// the other committers are still appending to the writer, we only sync the file handle
+			profiler.Start();
+			writer->handle->Sync();
+			profiler.End();
+		} catch (std::exception &ex) {
+			error = ErrorData(ex);
+		}
+		guard.lock();
+		sync_in_progress = false;
+		commit_cv.notify_all();
+		if (error.HasError()) {
+			// the commits are already visible to other transactions, we cannot revert them anymore
+			throw FatalException("Failed to sync the write-ahead log for a group of commits: %s", error.RawMessage());
+		}
+		RecordSync(sync_sequence - synced_commit_sequence, profiler.Elapsed());
+		synced_commit_sequence = sync_sequence;
+	}
+}
+
+void WriteAheadLog::RecordSync(idx_t batch_size, double sync_time) {
+	auto sync_time_us = LossyNumericCast<idx_t>(sync_time * 1000000.0);
+	commit_statistics.commits += batch_size;
+	commit_statistics.syncs++;
+	commit_statistics.max_batch_size = MaxValue<idx_t>(commit_statistics.max_batch_size, batch_size);
+	commit_statistics.total_sync_time_us += sync_time_us;
+	commit_statistics.max_sync_time_us = MaxValue<idx_t>(commit_statistics.max_sync_time_us, sync_time_us);
+}
+
+WALCommitStatistics WriteAheadLog::GetCommitStatistics() {
+	lock_guard<mutex> guard(commit_lock);
+	return commit_statistics;
+}
+
 } // namespace duckdb
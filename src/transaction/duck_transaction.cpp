@@ -215,7 +215,7 @@ ErrorData DuckTransaction::WriteToWAL(AttachedDatabase &db, unique_ptr<StorageCo
 }
 
 ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit_id,
-                                  unique_ptr<StorageCommitState> commit_state) noexcept {
+                                  optional_ptr<StorageCommitState> commit_state) noexcept {
 	// "checkpoint" parameter indicates if the caller will checkpoint. If checkpoint ==
 	//    true: Then this function will NOT write to the WAL or flush/persist.
 	//          This method only makes commit in memory, expecting caller to checkpoint/flush.
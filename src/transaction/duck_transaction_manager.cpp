@@ -256,7 +256,7 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	transaction_t commit_id = GetCommitTimestamp();
 	// commit the UndoBuffer of the transaction
 	if (!error.HasError()) {
-		error = transaction.Commit(db, commit_id, std::move(commit_state));
+		error = transaction.Commit(db, commit_id, commit_state.get());
 	}
 	if (error.HasError()) {
 		// commit unsuccessful: rollback the transaction instead
@@ -268,6 +268,20 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		if (transaction.catalog_version >= TRANSACTION_ID_START) {
 			transaction.catalog_version = ++last_committed_version;
 		}
+		if (commit_state && commit_state->HasPendingSync()) {
+			// group commit: the commit has been written to the WAL but the WAL has not been synced yet
+			// we release the WAL lock and the transaction lock while waiting for the sync
+			// this allows other transactions to write their commits to the WAL, so they can be synced together
+			// note that we still hold the write lock, which prevents the WAL from being checkpointed in the meantime
+			held_wal_lock.reset();
+			tlock.unlock();
+			try {
+				commit_state->SyncCommit();
+			} catch (std::exception &ex) {
+				error = ErrorData(ex);
+			}
+			tlock.lock();
+		}
 	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
 
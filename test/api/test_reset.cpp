@@ -92,6 +92,7 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"partitioned_write_flush_threshold", {123}},
 	    {"preserve_identifier_case", {false}},
 	    {"preserve_insertion_order", {false}},
+	    {"incremental_checkpoint", {false}},
 	    {"profile_output", {"test"}},
 	    {"profiling_mode", {"detailed"}},
 	    {"enable_progress_bar_print", {false}},
@@ -102,7 +103,8 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"force_bitpacking_mode", {"constant"}},
 	    {"http_logging_output", {"my_cool_outputfile"}},
-	    {"allocator_flush_threshold", {"4.0 GiB"}}};
+	    {"allocator_flush_threshold", {"4.0 GiB"}},
+	    {"eviction_policy", {"BLOCK=TWO_QUEUE, MANAGED_BUFFER=LRU, TINY_BUFFER=LRU"}}};
 	// Every option that's not excluded has to be part of this map
 	if (!value_map.count(name)) {
 		switch (type) {
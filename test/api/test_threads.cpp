@@ -1,5 +1,6 @@
 #include "catch.hpp"
 #include "test_helpers.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 #include <thread>
 
@@ -137,3 +138,95 @@ TEST_CASE("Test scheduling with no threads", "[api]") {
 	REQUIRE_NO_FAIL(query_1->Execute());
 }
 #endif
+
+class PriorityTestTask : public Task {
+public:
+	PriorityTestTask(mutex &lock, duckdb::vector<idx_t> &order, idx_t producer_idx)
+	    : lock(lock), order(order), producer_idx(producer_idx) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		lock_guard<mutex> guard(lock);
+		order.push_back(producer_idx);
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	mutex &lock;
+	duckdb::vector<idx_t> &order;
+	idx_t producer_idx;
+};
+
+TEST_CASE("Test that producers with a higher priority get a larger share of the tasks", "[api]") {
+	static constexpr idx_t TASK_COUNT = 100;
+
+	// no background threads: we execute the tasks ourselves
+	DBConfig config;
+	config.options.maximum_threads = 1;
+	DuckDB db(nullptr, &config);
+	auto &scheduler = TaskScheduler::GetScheduler(*db.instance);
+
+	mutex lock;
+	duckdb::vector<idx_t> order;
+	auto low_priority = scheduler.CreateProducer();
+	auto high_priority = scheduler.CreateProducer();
+	high_priority->statistics->priority = 10;
+	// interleave the tasks, so that without priorities both producers would get half of the threads' time
+	for (idx_t i = 0; i < TASK_COUNT; i++) {
+		scheduler.ScheduleTask(*low_priority, make_shared_ptr<PriorityTestTask>(lock, order, 0));
+		scheduler.ScheduleTask(*high_priority, make_shared_ptr<PriorityTestTask>(lock, order, 1));
+	}
+
+	// execute half of the tasks: most of them should be from the high priority producer
+	scheduler.ExecuteTasks(TASK_COUNT);
+	REQUIRE(order.size() == TASK_COUNT);
+	idx_t high_priority_tasks = 0;
+	for (auto producer_idx : order) {
+		high_priority_tasks += producer_idx;
+	}
+	REQUIRE(high_priority_tasks >= TASK_COUNT * 3 / 4);
+
+	// the time spent executing the tasks is attributed to their producer
+	auto low_priority_tasks = TASK_COUNT - high_priority_tasks;
+	REQUIRE(high_priority->statistics->task_time_us >= high_priority_tasks * 1000);
+	REQUIRE(low_priority->statistics->task_time_us >= low_priority_tasks * 1000);
+	REQUIRE(high_priority->statistics->virtual_time_us < high_priority->statistics->task_time_us);
+
+	// the remaining tasks are executed as well
+	scheduler.ExecuteTasks(TASK_COUNT);
+	REQUIRE(order.size() == 2 * TASK_COUNT);
+	REQUIRE(high_priority->statistics->queued_tasks == 0);
+	REQUIRE(low_priority->statistics->queued_tasks == 0);
+}
+
+TEST_CASE("Test replaying the WAL in parallel before the threads are launched", "[api]") {
+	auto db_path = TestCreatePath("wal_replay_threads.db");
+	DeleteDatabase(db_path);
+
+	DBConfig config;
+	config.options.maximum_threads = 4;
+	config.options.checkpoint_on_shutdown = false;
+	config.options.checkpoint_wal_size = idx_t(1) << 40;
+	{
+		DuckDB db(db_path, &config);
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE a AS SELECT range AS i FROM range(100000)"));
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE b AS SELECT range::VARCHAR AS s FROM range(50000)"));
+	}
+	{
+		// the WAL is replayed while the database is loaded: the inserts are replayed by workers of the replay itself
+		DuckDB db(db_path, &config);
+		Connection con(db);
+		auto result = con.Query("SELECT replay_threads, checkpointed FROM duckdb_wal_replay()");
+		REQUIRE(CHECK_COLUMN(result, 0, {4}));
+		REQUIRE(CHECK_COLUMN(result, 1, {false}));
+		result = con.Query("SELECT SUM(i), COUNT(*) FROM a");
+		REQUIRE(CHECK_COLUMN(result, 0, {Value::HUGEINT(4999950000)}));
+		REQUIRE(CHECK_COLUMN(result, 1, {100000}));
+		result = con.Query("SELECT MAX(s::INTEGER), COUNT(DISTINCT s) FROM b");
+		REQUIRE(CHECK_COLUMN(result, 0, {49999}));
+		REQUIRE(CHECK_COLUMN(result, 1, {50000}));
+	}
+	DeleteDatabase(db_path);
+}
@@ -3,6 +3,8 @@
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/fstream.hpp"
 #include "duckdb/common/local_file_system.hpp"
+#include "duckdb/common/virtual_file_system.hpp"
+#include "duckdb/main/database.hpp"
 #include "test_helpers.hpp"
 
 using namespace duckdb;
@@ -116,3 +118,60 @@ TEST_CASE("absolute paths", "[file_system]") {
 	REQUIRE(fs.NormalizeAbsolutePath(long_path) == "\\\\?\\d:\\very long network\\");
 #endif
 }
+
+//! A local file system that pretends its files are not on disk, so that readers treat them as remote files
+class NotOnDiskFileSystem : public LocalFileSystem {
+public:
+	static constexpr const char *PREFIX = "notondisk://";
+
+	duckdb::unique_ptr<FileHandle> OpenFile(const string &path, FileOpenFlags flags,
+	                                        optional_ptr<FileOpener> opener = nullptr) override {
+		// remote readers request direct I/O, which the local file system only supports for aligned reads
+		auto handle = LocalFileSystem::OpenFile(StripPrefix(path), FileFlags::FILE_FLAGS_READ, opener);
+		handle->path = path;
+		return handle;
+	}
+	duckdb::vector<string> Glob(const string &path, FileOpener *opener = nullptr) override {
+		return {path};
+	}
+	bool FileExists(const string &filename, optional_ptr<FileOpener> opener = nullptr) override {
+		return LocalFileSystem::FileExists(StripPrefix(filename), opener);
+	}
+	bool CanHandleFile(const string &fpath) override {
+		return StringUtil::StartsWith(fpath, PREFIX);
+	}
+	bool OnDiskFile(FileHandle &handle) override {
+		return false;
+	}
+	std::string GetName() const override {
+		return "NotOnDiskFileSystem";
+	}
+
+private:
+	static string StripPrefix(const string &path) {
+		return path.substr(strlen(PREFIX));
+	}
+};
+
+TEST_CASE("Test pruning Parquet pages of files that are not on disk", "[file_system]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	if (!db.ExtensionIsLoaded("parquet")) {
+		return;
+	}
+	db.GetFileSystem().RegisterSubSystem(make_uniq<NotOnDiskFileSystem>());
+
+	// the page indexes are prefetched in one go, the generated file_row_number column has no page index
+	auto result = con.Query("SELECT MIN(file_row_number), MAX(file_row_number), COUNT(*) FROM "
+	                        "read_parquet('notondisk://data/parquet-testing/page_index.parquet', file_row_number=true) "
+	                        "WHERE id BETWEEN 7777 AND 8888");
+	REQUIRE(CHECK_COLUMN(result, 0, {7777}));
+	REQUIRE(CHECK_COLUMN(result, 1, {8888}));
+	REQUIRE(CHECK_COLUMN(result, 2, {1112}));
+
+	result = con.Query("SELECT COUNT(*), SUM(id) FROM "
+	                   "read_parquet('notondisk://data/parquet-testing/page_index.parquet', file_row_number=true) "
+	                   "WHERE file_row_number BETWEEN 100 AND 199 AND id >= 150");
+	REQUIRE(CHECK_COLUMN(result, 0, {50}));
+	REQUIRE(CHECK_COLUMN(result, 1, {8725}));
+}
@@ -343,3 +343,37 @@ TEST_CASE("Test buffer allocator", "[storage][.]") {
 
 	allocator.FreeData(pointer, current_size);
 }
+
+TEST_CASE("Test reading ahead blocks in table scans", "[storage]") {
+	duckdb::unique_ptr<MaterializedQueryResult> result;
+	auto storage_database = TestCreatePath("read_ahead_test");
+	auto config = GetTestConfig();
+
+	// make sure the database does not exist
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		// hashes do not compress, so that every row group spans several adjacent blocks
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE vals AS SELECT i, hash(i) AS h FROM range(1000000) t(i)"));
+		REQUIRE_NO_FAIL(con.Query("CHECKPOINT"));
+	}
+	// reload the database, so that none of the blocks of the table are loaded
+	DuckDB db(storage_database, config.get());
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("SET scan_prefetch_depth=64"));
+
+	auto &buffer_manager = BufferManager::GetBufferManager(*con.context);
+	auto prefetched_blocks = buffer_manager.GetPrefetchedBlockCount();
+	result = con.Query("SELECT SUM(i)::BIGINT, COUNT(h), BOOL_AND(h = hash(i)) FROM vals");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(499999500000)}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(1000000)}));
+	REQUIRE(CHECK_COLUMN(result, 2, {Value::BOOLEAN(true)}));
+	// the blocks were loaded ahead of the scan with batched reads
+	REQUIRE(buffer_manager.GetPrefetchedBlockCount() > prefetched_blocks);
+
+	// a limit stops the scan while blocks are still being read ahead
+	result = con.Query("SELECT COUNT(*) FROM (SELECT * FROM vals LIMIT 300000)");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(300000)}));
+	DeleteDatabase(storage_database);
+}
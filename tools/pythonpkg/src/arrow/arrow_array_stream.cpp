@@ -6,6 +6,7 @@
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 
@@ -378,6 +379,26 @@ py::object TransformFilterRecursive(TableFilter *filter, vector<string> &column_
 
 		return child_expr;
 	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter->Cast<InFilter>();
+		auto constant_field = field(py::tuple(py::cast(column_ref)));
+		py::object expression = constant_field.attr("__eq__")(GetScalar(in_filter.values[0], timezone_config, type));
+		for (idx_t i = 1; i < in_filter.values.size(); i++) {
+			auto constant_value = GetScalar(in_filter.values[i], timezone_config, type);
+			expression = expression.attr("__or__")(constant_field.attr("__eq__")(constant_value));
+		}
+		return expression;
+	}
+	case TableFilterType::BLOOM_FILTER: {
+		//! Bloom filters cannot be expressed in Arrow - they never remove matching rows, so we can skip them
+		py::object dataset_scalar = import_cache.pyarrow.dataset().attr("scalar");
+		return dataset_scalar(true);
+	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		//! The value of a dynamic filter is not known when the scan is set up - it never removes result rows either
+		py::object dataset_scalar = import_cache.pyarrow.dataset().attr("scalar");
+		return dataset_scalar(true);
+	}
 	default:
 		throw NotImplementedException("Pushdown Filter Type not supported in Arrow Scans");
 	}